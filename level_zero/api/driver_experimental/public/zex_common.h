@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,6 +54,44 @@ typedef struct _zex_write_to_mem_desc_t {
     zex_mem_action_scope_flags_t writeScope;
 } zex_write_to_mem_desc_t;
 
+#define ZEX_MAX_IOCTL_NAME_SIZE 64
+#define ZEX_MAX_IOCTL_ERROR_CODES 8
+#define ZEX_IOCTL_ERROR_CODE_OTHER -1 ///< error code reported for failures with errno values not tracked individually
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Statistics of a single kernel driver call type, times in nanoseconds
+typedef struct _zex_ioctl_statistics_t {
+    char name[ZEX_MAX_IOCTL_NAME_SIZE]; ///< [out] name of the kernel driver call
+    uint64_t count;                     ///< [out] number of calls
+    uint64_t totalTime;                 ///< [out] accumulated time spent in calls
+    uint64_t minTime;                   ///< [out] shortest call
+    uint64_t maxTime;                   ///< [out] longest call
+    uint64_t p50Time;                   ///< [out] median call time, upper bound of its power of two bucket
+    uint64_t p90Time;                   ///< [out] 90th percentile call time, upper bound of its power of two bucket
+    uint64_t p99Time;                   ///< [out] 99th percentile call time, upper bound of its power of two bucket
+    uint64_t errorCount;                ///< [out] number of failed calls
+    uint32_t errorCodeCount;            ///< [out] number of valid entries in errorCodes and errorCodeOccurrences
+    int32_t errorCodes[ZEX_MAX_IOCTL_ERROR_CODES];            ///< [out] most frequent error codes
+    uint64_t errorCodeOccurrences[ZEX_MAX_IOCTL_ERROR_CODES]; ///< [out] number of failures with given error code
+} zex_ioctl_statistics_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Completion condition of multi-event host wait
+typedef enum _zex_event_wait_mode_t {
+    ZEX_EVENT_WAIT_MODE_ALL = 0, ///< wait until all events are signaled
+    ZEX_EVENT_WAIT_MODE_ANY = 1, ///< wait until any event is signaled
+    ZEX_EVENT_WAIT_MODE_FORCE_UINT32 = 0x7fffffff
+} zex_event_wait_mode_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Statistics of a single multi-event host wait, times in nanoseconds
+typedef struct _zex_event_wait_statistics_t {
+    uint64_t pollPasses;       ///< [out] number of passes over pending events
+    uint64_t sleepCount;       ///< [out] number of sleeps after spin budget was used
+    uint64_t waitTime;         ///< [out] total time spent in wait
+    uint64_t maxWakeupLatency; ///< [out] longest time between a pass that signaled an event and the pass before it
+} zex_event_wait_statistics_t;
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/api/driver_experimental/public/zex_device.h"
+
+#include "shared/source/device/device.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/os_interface.h"
+
+#include "level_zero/core/source/device/device.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+static_assert(ZEX_IOCTL_ERROR_CODE_OTHER == NEO::DriverCallStatistics::otherErrorCode);
+
+ze_result_t ZE_APICALL
+zexDeviceGetIoctlStatistics(
+    ze_device_handle_t hDevice,
+    uint32_t *pCount,
+    zex_ioctl_statistics_t *pStatistics) {
+    if (pCount == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    auto neoDevice = L0::Device::fromHandle(hDevice)->getNEODevice();
+    auto osInterface = neoDevice->getRootDeviceEnvironment().osInterface.get();
+
+    std::vector<NEO::DriverCallStatistics> statistics;
+    if (osInterface == nullptr || !osInterface->getDriverModel()->getDriverCallStatistics(statistics)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto availableCount = static_cast<uint32_t>(statistics.size());
+    if (*pCount == 0 || pStatistics == nullptr) {
+        *pCount = availableCount;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    *pCount = std::min(*pCount, availableCount);
+    for (uint32_t i = 0; i < *pCount; i++) {
+        auto &source = statistics[i];
+        auto &destination = pStatistics[i];
+
+        memset(destination.name, 0, sizeof(destination.name));
+        strncpy_s(destination.name, sizeof(destination.name), source.name.c_str(), sizeof(destination.name) - 1);
+        destination.count = source.count;
+        destination.totalTime = source.totalTime;
+        destination.minTime = source.minTime;
+        destination.maxTime = source.maxTime;
+        destination.p50Time = source.p50Time;
+        destination.p90Time = source.p90Time;
+        destination.p99Time = source.p99Time;
+        destination.errorCount = source.errorCount;
+
+        auto errorCodes = source.errorCodes;
+        std::stable_sort(errorCodes.begin(), errorCodes.end(), [](const auto &lhs, const auto &rhs) { return lhs.second > rhs.second; });
+        destination.errorCodeCount = static_cast<uint32_t>(std::min(errorCodes.size(), static_cast<size_t>(ZEX_MAX_IOCTL_ERROR_CODES)));
+        for (uint32_t error = 0; error < destination.errorCodeCount; error++) {
+            destination.errorCodes[error] = errorCodes[error].first;
+            destination.errorCodeOccurrences[error] = errorCodes[error].second;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+} // namespace L0
+
+extern "C" {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexDeviceGetIoctlStatistics(
+    ze_device_handle_t hDevice,
+    uint32_t *pCount,
+    zex_ioctl_statistics_t *pStatistics) {
+    return L0::zexDeviceGetIoctlStatistics(hDevice, pCount, pStatistics);
+}
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef _ZEX_DEVICE_H
+#define _ZEX_DEVICE_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/api/driver_experimental/public/zex_common.h"
+
+namespace L0 {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get statistics of kernel driver calls issued on behalf of the device
+///
+/// @details
+///     - Statistics are collected only when enabled with EnableIoctlStatistics
+///       or PrintIoctlTimes debug keys.
+///     - The application may call this function from simultaneous threads.
+///     - If pCount is zero, it is updated with the number of call types that
+///       have statistics available.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `nullptr == pCount`
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + statistics are not collected for the device
+ze_result_t ZE_APICALL
+zexDeviceGetIoctlStatistics(
+    ze_device_handle_t hDevice,         ///< [in] handle of the device
+    uint32_t *pCount,                   ///< [in,out] number of statistics entries
+    zex_ioctl_statistics_t *pStatistics ///< [in,out][optional][range(0, *pCount)] array of statistics entries
+);
+
+} // namespace L0
+#endif // _ZEX_DEVICE_H
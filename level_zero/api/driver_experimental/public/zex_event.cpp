@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/api/driver_experimental/public/zex_event.h"
+
+#include "level_zero/core/source/event/event.h"
+
+#include <vector>
+
+namespace L0 {
+
+ze_result_t ZE_APICALL
+zexEventsHostSynchronize(
+    uint32_t numEvents,
+    zex_event_handle_t *phEvents,
+    zex_event_wait_mode_t mode,
+    uint64_t timeout,
+    uint32_t *pSignaledIndex,
+    zex_event_wait_statistics_t *pStatistics) {
+    if (phEvents == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (numEvents == 0) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+    if (mode != ZEX_EVENT_WAIT_MODE_ALL && mode != ZEX_EVENT_WAIT_MODE_ANY) {
+        return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+
+    std::vector<Event *> events(numEvents);
+    for (uint32_t i = 0; i < numEvents; i++) {
+        events[i] = Event::fromHandle(phEvents[i]);
+    }
+
+    EventsWaitStatistics statistics{};
+    auto result = Event::hostSynchronizeEvents(numEvents, events.data(), mode == ZEX_EVENT_WAIT_MODE_ALL, timeout, pSignaledIndex, &statistics);
+
+    if (pStatistics) {
+        pStatistics->pollPasses = statistics.pollPasses;
+        pStatistics->sleepCount = statistics.sleepCount;
+        pStatistics->waitTime = statistics.waitTime;
+        pStatistics->maxWakeupLatency = statistics.maxWakeupLatency;
+    }
+    return result;
+}
+
+} // namespace L0
+
+extern "C" {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventsHostSynchronize(
+    uint32_t numEvents,
+    zex_event_handle_t *phEvents,
+    zex_event_wait_mode_t mode,
+    uint64_t timeout,
+    uint32_t *pSignaledIndex,
+    zex_event_wait_statistics_t *pStatistics) {
+    return L0::zexEventsHostSynchronize(numEvents, phEvents, mode, timeout, pSignaledIndex, pStatistics);
+}
+}
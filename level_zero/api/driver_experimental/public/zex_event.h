@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef _ZEX_EVENT_H
+#define _ZEX_EVENT_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/api/driver_experimental/public/zex_common.h"
+
+namespace L0 {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Wait on the host until all or any of the given events are signaled
+///
+/// @details
+///     - All pending events are polled in a single pass, the calling thread
+///       starts sleeping with exponential backoff once the spin budget is used.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_NOT_READY
+///         + timeout expired
+///     - ::ZE_RESULT_ERROR_DEVICE_LOST
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `nullptr == phEvents`
+///     - ::ZE_RESULT_ERROR_INVALID_SIZE
+///         + `0 == numEvents`
+///     - ::ZE_RESULT_ERROR_INVALID_ENUMERATION
+///         + `::ZEX_EVENT_WAIT_MODE_ANY < mode`
+ze_result_t ZE_APICALL
+zexEventsHostSynchronize(
+    uint32_t numEvents,                      ///< [in] number of events
+    zex_event_handle_t *phEvents,            ///< [in][range(0, numEvents)] handles of the events
+    zex_event_wait_mode_t mode,              ///< [in] wait for all or any of the events
+    uint64_t timeout,                        ///< [in] timeout in nanoseconds, UINT64_MAX waits indefinitely
+    uint32_t *pSignaledIndex,                ///< [out][optional] index of first signaled event
+    zex_event_wait_statistics_t *pStatistics ///< [out][optional] statistics of the wait
+);
+
+} // namespace L0
+#endif // _ZEX_EVENT_H
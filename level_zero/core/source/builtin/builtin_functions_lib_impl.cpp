@@ -183,9 +183,47 @@ void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
 
 BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib) : device(device), builtInsLib(builtInsLib) {
     if (initBuiltinsAsyncEnabled(device)) {
-        this->initAsyncComplete = false;
-        this->initAsync = std::async(std::launch::async, &BuiltinFunctionsLibImpl::initBuiltinKernel, this, Builtin::FillBufferImmediate);
+        auto warmUpBuiltinsAsync = NEO::DebugManager.flags.WarmUpBuiltinsAsync.get();
+        if (warmUpBuiltinsAsync == 1) {
+            this->initAsyncComplete = false;
+            this->initAsync = std::async(std::launch::async, &BuiltinFunctionsLibImpl::warmUpBuiltins, this);
+        } else if (warmUpBuiltinsAsync != 0) {
+            this->initAsyncComplete = false;
+            this->initAsync = std::async(std::launch::async, &BuiltinFunctionsLibImpl::initBuiltinKernel, this, Builtin::FillBufferImmediate);
+        }
+    }
+}
+
+void BuiltinFunctionsLibImpl::warmUpBuiltins() {
+    // builtins used by the first memory copy and fill appended to a command list
+    constexpr Builtin warmUpList[] = {
+        Builtin::CopyBufferBytes,
+        Builtin::CopyBufferToBufferMiddle,
+        Builtin::CopyBufferToBufferSide,
+        Builtin::FillBufferImmediate,
+        Builtin::FillBufferImmediateLeftOver,
+        Builtin::FillBufferMiddle,
+        Builtin::FillBufferRightLeftover};
+
+    for (auto builtin : warmUpList) {
+        auto builtId = static_cast<uint32_t>(builtin);
+        initBuiltinKernel(builtin);
+        if (builtins[builtId]) {
+            this->warmedUpBuiltins.set(builtId);
+            PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stdout, "Warmed up builtin kernel %u\n", builtId);
+        }
     }
+    PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stdout, "Warmed up %zu builtin kernels\n", this->warmedUpBuiltins.count());
+}
+
+uint32_t BuiltinFunctionsLibImpl::getWarmedUpBuiltinsCount() {
+    this->ensureInitCompletion();
+    return static_cast<uint32_t>(this->warmedUpBuiltins.count());
+}
+
+bool BuiltinFunctionsLibImpl::isBuiltinWarmedUp(Builtin func) {
+    this->ensureInitCompletion();
+    return this->warmedUpBuiltins.test(static_cast<uint32_t>(func));
 }
 
 Kernel *BuiltinFunctionsLibImpl::getFunction(Builtin func) {
@@ -217,39 +255,38 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
         return nullptr;
     }
 
-    StackVec<BuiltInCodeType, 2> supportedTypes{};
-    if (!NEO::DebugManager.flags.RebuildPrecompiledKernels.get()) {
-        supportedTypes.push_back(BuiltInCodeType::Binary);
+    if (this->modules.size() <= builtin) {
+        this->modules.resize(builtin + 1u);
     }
-    supportedTypes.push_back(BuiltInCodeType::Intermediate);
-
-    NEO::BuiltinCode builtinCode{};
 
-    for (auto &builtinCodeType : supportedTypes) {
-        builtinCode = builtInsLib->getBuiltinsLib().getBuiltinCode(builtin, builtinCodeType, *device->getNEODevice());
-        if (!builtinCode.resource.empty()) {
-            break;
+    // several builtin kernels share one module, builtin code is fetched only when the module is created
+    if (this->modules[builtin].get() == nullptr) {
+        StackVec<BuiltInCodeType, 2> supportedTypes{};
+        if (!NEO::DebugManager.flags.RebuildPrecompiledKernels.get()) {
+            supportedTypes.push_back(BuiltInCodeType::Binary);
         }
-    }
+        supportedTypes.push_back(BuiltInCodeType::Intermediate);
 
-    if (builtinCode.resource.empty() || !NEO::EmbeddedStorageRegistry::exists) {
-        return nullptr;
-    }
+        NEO::BuiltinCode builtinCode{};
 
-    [[maybe_unused]] ze_result_t res;
+        for (auto &builtinCodeType : supportedTypes) {
+            builtinCode = builtInsLib->getBuiltinsLib().getBuiltinCode(builtin, builtinCodeType, *device->getNEODevice());
+            if (!builtinCode.resource.empty()) {
+                break;
+            }
+        }
 
-    if (this->modules.size() <= builtin) {
-        this->modules.resize(builtin + 1u);
-    }
+        if (builtinCode.resource.empty() || !NEO::EmbeddedStorageRegistry::exists) {
+            return nullptr;
+        }
 
-    if (this->modules[builtin].get() == nullptr) {
         std::unique_ptr<Module> module;
         ze_module_handle_t moduleHandle;
         ze_module_desc_t moduleDesc = {};
         moduleDesc.format = builtinCode.type == BuiltInCodeType::Binary ? ZE_MODULE_FORMAT_NATIVE : ZE_MODULE_FORMAT_IL_SPIRV;
         moduleDesc.pInputModule = reinterpret_cast<uint8_t *>(&builtinCode.resource[0]);
         moduleDesc.inputSize = builtinCode.resource.size();
-        res = device->createModule(&moduleDesc, &moduleHandle, nullptr, ModuleType::Builtin);
+        auto res = device->createModule(&moduleDesc, &moduleHandle, nullptr, ModuleType::Builtin);
         UNRECOVERABLE_IF(res != ZE_RESULT_SUCCESS);
 
         module.reset(Module::fromHandle(moduleHandle));
@@ -260,7 +297,7 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
     ze_kernel_handle_t kernelHandle;
     ze_kernel_desc_t kernelDesc = {};
     kernelDesc.pKernelName = builtInName;
-    res = this->modules[builtin]->createKernel(&kernelDesc, &kernelHandle);
+    [[maybe_unused]] auto res = this->modules[builtin]->createKernel(&kernelDesc, &kernelHandle);
     DEBUG_BREAK_IF(res != ZE_RESULT_SUCCESS);
 
     kernel.reset(Kernel::fromHandle(kernelHandle));
@@ -9,6 +9,7 @@
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/module/module.h"
 
+#include <bitset>
 #include <future>
 #include <vector>
 
@@ -40,7 +41,12 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
 
     static bool initBuiltinsAsyncEnabled(Device *device);
 
+    uint32_t getWarmedUpBuiltinsCount();
+    bool isBuiltinWarmedUp(Builtin func);
+
   protected:
+    void warmUpBuiltins();
+
     std::vector<std::unique_ptr<Module>> modules = {};
     std::unique_ptr<BuiltinData> builtins[static_cast<uint32_t>(Builtin::COUNT)];
     std::unique_ptr<BuiltinData> imageBuiltins[static_cast<uint32_t>(ImageBuiltin::COUNT)];
@@ -49,6 +55,7 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
 
     std::future<void> initAsync = {};
     bool initAsyncComplete = true;
+    std::bitset<static_cast<uint32_t>(Builtin::COUNT)> warmedUpBuiltins;
 };
 struct BuiltinFunctionsLibImpl::BuiltinData {
     MOCKABLE_VIRTUAL ~BuiltinData();
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "shared/source/command_stream/transfer_direction.h"
+#include "shared/source/helpers/blit_helper.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/sku_info/sku_info_base.h"
 
@@ -88,7 +89,7 @@ struct BcsSplit {
 
         auto totalSize = size;
         auto engineCount = cmdQsForSplit.size();
-        for (size_t i = 0; i < cmdQsForSplit.size(); i++) {
+        for (size_t i = 0; i < cmdQsForSplit.size() && totalSize > 0; i++) {
             if (barrierRequired) {
                 auto barrierEventHandle = this->events.barrier[markerEventIndex]->toHandle();
                 cmdList->addEventsToCmdList(1u, &barrierEventHandle, hasRelaxedOrderingDependencies, false);
@@ -99,7 +100,7 @@ struct BcsSplit {
                 cmdList->appendEventForProfilingAllWalkers(Event::fromHandle(hSignalEvent), true, true);
             }
 
-            auto localSize = totalSize / engineCount;
+            auto localSize = NEO::BlitHelper::getBcsSplitSubcopySize(totalSize, engineCount);
             auto localDstPtr = ptrOffset(dstptr, size - totalSize);
             auto localSrcPtr = ptrOffset(srcptr, size - totalSize);
 
@@ -122,7 +123,7 @@ struct BcsSplit {
             }
         }
 
-        cmdList->addEventsToCmdList(static_cast<uint32_t>(cmdQsForSplit.size()), eventHandles.data(), hasRelaxedOrderingDependencies, false);
+        cmdList->addEventsToCmdList(static_cast<uint32_t>(eventHandles.size()), eventHandles.data(), hasRelaxedOrderingDependencies, false);
         if (hSignalEvent) {
             cmdList->appendEventForProfilingAllWalkers(Event::fromHandle(hSignalEvent), false, true);
         }
@@ -25,6 +25,7 @@
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_imp.h"
 #include "level_zero/core/source/driver/host_pointer_manager.h"
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
 #include "level_zero/core/source/fabric/fabric.h"
 #include "level_zero/core/source/image/image.h"
 
@@ -152,6 +153,8 @@ ze_result_t DriverHandleImp::getExtensionProperties(uint32_t *pCount,
 }
 
 DriverHandleImp::~DriverHandleImp() {
+    eventPoolSlabAllocator.reset();
+
     if (memoryManager != nullptr) {
         memoryManager->peekExecutionEnvironment().prepareForCleanup();
         if (this->svmAllocsManager) {
@@ -255,6 +258,14 @@ ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>
         createHostPointerManager();
     }
 
+    if (NEO::DebugManager.flags.EnableEventPoolSlabAllocator.get() == 1) {
+        size_t slabSize = EventPoolSlabAllocator::defaultSlabSize;
+        if (NEO::DebugManager.flags.EventPoolSlabSize.get() > 0) {
+            slabSize = static_cast<size_t>(NEO::DebugManager.flags.EventPoolSlabSize.get());
+        }
+        eventPoolSlabAllocator = std::make_unique<EventPoolSlabAllocator>(memoryManager, slabSize);
+    }
+
     return ZE_RESULT_SUCCESS;
 }
 
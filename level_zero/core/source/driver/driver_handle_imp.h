@@ -19,6 +19,7 @@
 
 namespace L0 {
 class HostPointerManager;
+class EventPoolSlabAllocator;
 struct FabricVertex;
 struct FabricEdge;
 struct Image;
@@ -93,6 +94,7 @@ struct DriverHandleImp : public DriverHandle {
     uint32_t getEventMaxKernelCount(uint32_t numDevices, ze_device_handle_t *deviceHandles) const override;
 
     std::unique_ptr<HostPointerManager> hostPointerManager;
+    std::unique_ptr<EventPoolSlabAllocator> eventPoolSlabAllocator;
     // Experimental functions
     std::unordered_map<std::string, void *> extensionFunctionsLookupMap;
 
@@ -7,6 +7,7 @@
 
 #include "level_zero/core/source/event/event.h"
 
+#include "shared/source/assert_handler/assert_handler.h"
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 #include "shared/source/command_stream/csr_definitions.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
@@ -16,6 +17,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -33,7 +35,9 @@
 #include "level_zero/core/source/event/event_impl.inl"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
+#include <algorithm>
 #include <set>
+#include <thread>
 
 namespace L0 {
 template Event *Event::create<uint64_t>(EventPool *, const ze_event_desc_t *, Device *);
@@ -94,12 +98,11 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
         allocationType = NEO::AllocationType::GPU_TIMESTAMP_DEVICE_BUFFER;
     }
 
-    eventPoolAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
-
     bool allocatedMemory = false;
 
     auto neoDevice = devices[0]->getNEODevice();
     if (this->isDeviceEventPoolAllocation) {
+        eventPoolAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
         this->isHostVisibleEventPoolAllocation = !(isEventPoolDeviceAllocationFlagSet());
         NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, neoDevice->getDeviceBitfield()};
         allocationProperties.alignment = eventAlignment;
@@ -114,7 +117,14 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
                 this->isShareableEventMemory = (graphicsAllocation->peekInternalHandle(memoryManager, handle) == 0);
             }
         }
+    } else if (driverHandleImp->eventPoolSlabAllocator && !(eventPoolFlags & ZE_EVENT_POOL_FLAG_IPC) &&
+               driverHandleImp->eventPoolSlabAllocator->allocate(rootDeviceIndices, allocationType, this->numEvents * this->eventSize, eventAlignment, slabChunk)) {
+        this->isHostVisibleEventPoolAllocation = true;
+        this->eventPoolSize = slabChunk.size;
+        eventPoolPtr = ptrOffset(slabChunk.allocations->getDefaultGraphicsAllocation()->getUnderlyingBuffer(), slabChunk.offset);
+        allocatedMemory = true;
     } else {
+        eventPoolAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
         this->isHostVisibleEventPoolAllocation = true;
         NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, systemMemoryBitfield};
         allocationProperties.alignment = eventAlignment;
@@ -132,13 +142,19 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
         return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
     }
     if (neoDevice->getDefaultEngine().commandStreamReceiver->isTbxMode()) {
-        eventPoolAllocations->getDefaultGraphicsAllocation()->setWriteMemoryOnly(true);
+        getAllocation().getDefaultGraphicsAllocation()->setWriteMemoryOnly(true);
     }
     return ZE_RESULT_SUCCESS;
 }
 
 EventPool::~EventPool() {
-    if (eventPoolAllocations) {
+    if (slabChunk.allocations) {
+        // slabs are already freed when the driver handle released its allocator before this pool
+        auto driverHandleImp = static_cast<DriverHandleImp *>(devices[0]->getDriverHandle());
+        if (driverHandleImp->eventPoolSlabAllocator) {
+            driverHandleImp->eventPoolSlabAllocator->free(slabChunk);
+        }
+    } else if (eventPoolAllocations) {
         auto graphicsAllocations = eventPoolAllocations->getGraphicsAllocations();
         auto memoryManager = devices[0]->getDriverHandle()->getMemoryManager();
         for (auto gpuAllocation : graphicsAllocations) {
@@ -385,6 +401,116 @@ void Event::resetPackets(bool resetAllPackets) {
     this->csrs.push_back(this->device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
 }
 
+ze_result_t Event::hostSynchronizeEvents(uint32_t numEvents, Event **events, bool waitAll, uint64_t timeout, uint32_t *signaledIndex, EventsWaitStatistics *statistics) {
+    using namespace std::chrono;
+
+    if (NEO::DebugManager.flags.OverrideEventSynchronizeTimeout.get() != -1) {
+        timeout = NEO::DebugManager.flags.OverrideEventSynchronizeTimeout.get();
+    }
+
+    microseconds spinBudget{100};
+    if (NEO::DebugManager.flags.EventsWaitSpinBudgetUs.get() != -1) {
+        spinBudget = microseconds{NEO::DebugManager.flags.EventsWaitSpinBudgetUs.get()};
+    }
+    microseconds maxSleepTime{128};
+    if (NEO::DebugManager.flags.EventsWaitMaxSleepUs.get() != -1) {
+        maxSleepTime = microseconds{NEO::DebugManager.flags.EventsWaitMaxSleepUs.get()};
+    }
+
+    EventsWaitStatistics waitStatistics{};
+    std::vector<uint32_t> pendingEvents;
+    std::vector<uint32_t> signaledEvents;
+    pendingEvents.reserve(numEvents);
+    for (uint32_t i = 0; i < numEvents; i++) {
+        if (events[i]->csrs[0]->getType() == NEO::CommandStreamReceiverType::CSR_AUB) {
+            signaledEvents.push_back(i);
+        } else {
+            pendingEvents.push_back(i);
+        }
+    }
+
+    ze_result_t ret = ZE_RESULT_NOT_READY;
+    const auto waitStartTime = steady_clock::now();
+    auto lastPollTime = waitStartTime;
+    auto lastHangCheckTime = waitStartTime;
+    auto sleepTime = microseconds{1};
+
+    while (true) {
+        // single pass over all pending events, compacting signaled ones out of the set
+        size_t stillPending = 0;
+        for (auto eventIndex : pendingEvents) {
+            if (events[eventIndex]->queryStatus() == ZE_RESULT_SUCCESS) {
+                signaledEvents.push_back(eventIndex);
+            } else {
+                pendingEvents[stillPending++] = eventIndex;
+            }
+        }
+        const bool signaledInThisPass = stillPending != pendingEvents.size();
+        pendingEvents.resize(stillPending);
+
+        const auto currentTime = steady_clock::now();
+        waitStatistics.pollPasses++;
+        if (signaledInThisPass) {
+            waitStatistics.maxWakeupLatency = std::max(waitStatistics.maxWakeupLatency, static_cast<uint64_t>(duration_cast<nanoseconds>(currentTime - lastPollTime).count()));
+        }
+        lastPollTime = currentTime;
+
+        if (pendingEvents.empty() || (!waitAll && !signaledEvents.empty())) {
+            ret = ZE_RESULT_SUCCESS;
+            break;
+        }
+
+        if (duration_cast<microseconds>(currentTime - lastHangCheckTime) >= events[pendingEvents[0]]->gpuHangCheckPeriod) {
+            lastHangCheckTime = currentTime;
+            auto hangDetected = std::any_of(pendingEvents.begin(), pendingEvents.end(), [&](uint32_t eventIndex) {
+                return events[eventIndex]->csrs[0]->isGpuHangDetected();
+            });
+            if (hangDetected) {
+                ret = ZE_RESULT_ERROR_DEVICE_LOST;
+                break;
+            }
+        }
+
+        const auto elapsedTime = duration_cast<nanoseconds>(currentTime - waitStartTime);
+        if (timeout != std::numeric_limits<uint64_t>::max() && static_cast<uint64_t>(elapsedTime.count()) >= timeout) {
+            break;
+        }
+
+        if (elapsedTime < spinBudget) {
+            NEO::WaitUtils::waitFunction(nullptr, 0u);
+        } else {
+            std::this_thread::sleep_for(sleepTime);
+            sleepTime = std::min(sleepTime * 2, maxSleepTime);
+            waitStatistics.sleepCount++;
+        }
+    }
+
+    waitStatistics.waitTime = duration_cast<nanoseconds>(steady_clock::now() - waitStartTime).count();
+    if (statistics) {
+        *statistics = waitStatistics;
+    }
+
+    if (ret == ZE_RESULT_SUCCESS) {
+        if (signaledIndex && !signaledEvents.empty()) {
+            *signaledIndex = signaledEvents[0];
+        }
+        // let each event finish its own completion handling (printf output, assert check)
+        for (auto eventIndex : signaledEvents) {
+            events[eventIndex]->hostSynchronize(0);
+        }
+    } else {
+        NEO::AssertHandler *checkedAssertHandler = nullptr;
+        for (auto eventIndex : pendingEvents) {
+            auto assertHandler = events[eventIndex]->device->getNEODevice()->getRootDeviceEnvironment().assertHandler.get();
+            if (assertHandler && assertHandler != checkedAssertHandler) {
+                assertHandler->printAssertAndAbort();
+                checkedAssertHandler = assertHandler;
+            }
+        }
+    }
+    return ret;
+}
+
 void Event::setIsCompleted() {
     if (this->isCompleted.load() == STATE_CLEARED) {
         this->isCompleted = STATE_SIGNALED;
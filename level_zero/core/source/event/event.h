@@ -10,6 +10,8 @@
 #include "shared/source/helpers/timestamp_packet_container.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
+
 #include <level_zero/ze_api.h>
 
 #include <atomic>
@@ -60,6 +62,13 @@ inline constexpr uint32_t maxKernelSplit = 3;
 inline constexpr uint32_t eventPackets = maxKernelSplit * NEO ::TimestampPacketConstants::preferredPacketCount;
 } // namespace EventPacketsCount
 
+struct EventsWaitStatistics {
+    uint64_t pollPasses = 0u;
+    uint64_t sleepCount = 0u;
+    uint64_t waitTime = 0u;
+    uint64_t maxWakeupLatency = 0u;
+};
+
 struct Event : _ze_event_handle_t {
     virtual ~Event() = default;
     virtual ze_result_t destroy();
@@ -82,6 +91,8 @@ struct Event : _ze_event_handle_t {
 
     static Event *fromHandle(ze_event_handle_t handle) { return static_cast<Event *>(handle); }
 
+    static ze_result_t hostSynchronizeEvents(uint32_t numEvents, Event **events, bool waitAll, uint64_t timeout, uint32_t *signaledIndex, EventsWaitStatistics *statistics);
+
     inline ze_event_handle_t toHandle() { return this; }
 
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation &getAllocation(Device *device) const;
@@ -278,7 +289,9 @@ struct EventPool : _ze_event_pool_handle_t {
 
     inline ze_event_pool_handle_t toHandle() { return this; }
 
-    MOCKABLE_VIRTUAL NEO::MultiGraphicsAllocation &getAllocation() { return *eventPoolAllocations; }
+    MOCKABLE_VIRTUAL NEO::MultiGraphicsAllocation &getAllocation() { return slabChunk.allocations ? *slabChunk.allocations : *eventPoolAllocations; }
+    size_t getAllocationOffset() const { return slabChunk.offset; }
+    bool isSlabAllocated() const { return slabChunk.allocations != nullptr; }
 
     uint32_t getEventSize() const { return eventSize; }
     void setEventSize(uint32_t size) { eventSize = size; }
@@ -321,6 +334,7 @@ struct EventPool : _ze_event_pool_handle_t {
     std::vector<Device *> devices;
 
     std::unique_ptr<NEO::MultiGraphicsAllocation> eventPoolAllocations;
+    EventPoolSlabChunk slabChunk;
     void *eventPoolPtr = nullptr;
     ContextImp *context = nullptr;
 
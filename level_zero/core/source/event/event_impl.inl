@@ -39,7 +39,7 @@ Event *Event::create(EventPool *eventPool, const ze_event_desc_t *desc, Device *
 
     uint64_t baseHostAddr = reinterpret_cast<uint64_t>(alloc->getUnderlyingBuffer());
     event->totalEventSize = eventPool->getEventSize();
-    event->eventPoolOffset = desc->index * event->totalEventSize;
+    event->eventPoolOffset = eventPool->getAllocationOffset() + desc->index * event->totalEventSize;
     event->hostAddress = reinterpret_cast<void *>(baseHostAddr + event->eventPoolOffset);
     event->signalScope = desc->signal;
     event->waitScope = desc->wait;
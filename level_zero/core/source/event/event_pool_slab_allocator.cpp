@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace L0 {
+
+EventPoolSlabAllocator::EventPoolSlabAllocator(NEO::MemoryManager *memoryManager, size_t slabSize) : memoryManager(memoryManager),
+                                                                                                     slabSize(alignUp(std::max(slabSize, minChunkSize), MemoryConstants::pageSize)) {
+}
+
+EventPoolSlabAllocator::~EventPoolSlabAllocator() {
+    for (auto &slab : slabs) {
+        freeSlab(*slab);
+    }
+}
+
+uint32_t EventPoolSlabAllocator::getSizeClass(size_t size) {
+    uint32_t sizeClass = 0u;
+    while (getSizeClassSize(sizeClass) < size) {
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+bool EventPoolSlabAllocator::allocate(const RootDeviceIndicesContainer &rootDeviceIndices, NEO::AllocationType allocationType,
+                                      size_t size, size_t alignment, EventPoolSlabChunk &chunk) {
+    if (size == 0u || size > getMaxChunkSize() || alignment > minChunkSize) {
+        return false;
+    }
+    auto sizeClass = getSizeClass(size);
+    if (sizeClass >= numSizeClasses) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &slab : slabs) {
+        if (slab->allocationType == allocationType && slab->rootDeviceIndices == rootDeviceIndices &&
+            allocateFromSlab(*slab, sizeClass, chunk)) {
+            return true;
+        }
+    }
+
+    auto slab = createSlab(rootDeviceIndices, allocationType);
+    if (slab == nullptr) {
+        return false;
+    }
+    statistics.slabsAllocated++;
+    return allocateFromSlab(*slab, sizeClass, chunk);
+}
+
+bool EventPoolSlabAllocator::allocateFromSlab(Slab &slab, uint32_t sizeClass, EventPoolSlabChunk &chunk) {
+    auto chunkSize = getSizeClassSize(sizeClass);
+    auto &freeChunks = slab.freeChunks[sizeClass];
+
+    if (!freeChunks.empty()) {
+        chunk.offset = freeChunks.back();
+        freeChunks.pop_back();
+        memset(ptrOffset(slab.hostPtr, chunk.offset), 0, chunkSize);
+        statistics.chunksReused++;
+    } else {
+        // chunk sizes are powers of two, so bumping an aligned offset keeps every chunk naturally aligned
+        auto offset = alignUp(slab.usedSize, chunkSize);
+        if (offset + chunkSize > slabSize) {
+            return false;
+        }
+        chunk.offset = offset;
+        slab.usedSize = offset + chunkSize;
+        statistics.chunksAllocated++;
+    }
+    chunk.allocations = slab.allocations.get();
+    chunk.size = chunkSize;
+    slab.chunksInUse++;
+    statistics.chunksInUse++;
+    return true;
+}
+
+void EventPoolSlabAllocator::free(const EventPoolSlabChunk &chunk) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto it = slabs.begin(); it != slabs.end(); it++) {
+        auto &slab = **it;
+        if (slab.allocations.get() != chunk.allocations) {
+            continue;
+        }
+        slab.chunksInUse--;
+        statistics.chunksInUse--;
+        if (slab.chunksInUse > 0u) {
+            slab.freeChunks[getSizeClass(chunk.size)].push_back(chunk.offset);
+        } else if (isOtherSlabEmpty(slab)) {
+            freeSlab(slab);
+            slabs.erase(it);
+            statistics.slabsReleased++;
+        } else {
+            resetSlab(slab);
+        }
+        return;
+    }
+    DEBUG_BREAK_IF(true);
+}
+
+bool EventPoolSlabAllocator::isOtherSlabEmpty(const Slab &slab) const {
+    for (auto &otherSlab : slabs) {
+        if (otherSlab.get() != &slab && otherSlab->chunksInUse == 0u) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void EventPoolSlabAllocator::resetSlab(Slab &slab) {
+    // one empty slab is kept for pools created right after, chunks are carved again so any size class may use it
+    memset(slab.hostPtr, 0, slab.usedSize);
+    slab.usedSize = 0u;
+    for (auto &freeChunks : slab.freeChunks) {
+        freeChunks.clear();
+    }
+}
+
+EventPoolSlabAllocator::Slab *EventPoolSlabAllocator::createSlab(const RootDeviceIndicesContainer &rootDeviceIndices, NEO::AllocationType allocationType) {
+    auto maxRootDeviceIndex = *std::max_element(rootDeviceIndices.begin(), rootDeviceIndices.end());
+
+    auto slab = std::make_unique<Slab>();
+    slab->allocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
+    slab->rootDeviceIndices = rootDeviceIndices;
+    slab->allocationType = allocationType;
+
+    NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), slabSize, allocationType, systemMemoryBitfield};
+    allocationProperties.alignment = MemoryConstants::pageSize64k;
+    slab->hostPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(slab->rootDeviceIndices,
+                                                                                   allocationProperties,
+                                                                                   *slab->allocations);
+    if (slab->hostPtr == nullptr) {
+        return nullptr;
+    }
+
+    slabs.push_back(std::move(slab));
+    return slabs.back().get();
+}
+
+void EventPoolSlabAllocator::freeSlab(Slab &slab) {
+    for (auto graphicsAllocation : slab.allocations->getGraphicsAllocations()) {
+        memoryManager->freeGraphicsMemory(graphicsAllocation);
+    }
+}
+
+void EventPoolSlabAllocator::getStatistics(EventPoolSlabStatistics &statistics) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    statistics = this->statistics;
+}
+
+} // namespace L0
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/allocation_type.h"
+#include "shared/source/memory_manager/multi_graphics_allocation.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class MemoryManager;
+} // namespace NEO
+
+namespace L0 {
+
+struct EventPoolSlabChunk {
+    NEO::MultiGraphicsAllocation *allocations = nullptr;
+    size_t offset = 0u;
+    size_t size = 0u;
+};
+
+struct EventPoolSlabStatistics {
+    uint64_t slabsAllocated = 0u;
+    uint64_t slabsReleased = 0u;
+    uint64_t chunksAllocated = 0u;
+    uint64_t chunksReused = 0u;
+    uint64_t chunksInUse = 0u;
+};
+
+// Serves memory of small host visible event pools from large shared allocations (slabs).
+// Each slab is split into power-of-two sized chunks; chunks released by destroyed pools are kept
+// on per-size freelists of their slab and handed out zeroed to following pools, so pools created
+// and destroyed at high rate do not reach the memory manager.
+// A slab whose last chunk is released is returned to the memory manager, unless it is the only empty slab.
+class EventPoolSlabAllocator : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultSlabSize = 32 * MemoryConstants::pageSize64k;
+    static constexpr size_t minChunkSize = MemoryConstants::pageSize;
+    static constexpr size_t numSizeClasses = 16u;
+
+    EventPoolSlabAllocator(NEO::MemoryManager *memoryManager, size_t slabSize);
+    MOCKABLE_VIRTUAL ~EventPoolSlabAllocator();
+
+    bool allocate(const RootDeviceIndicesContainer &rootDeviceIndices, NEO::AllocationType allocationType,
+                  size_t size, size_t alignment, EventPoolSlabChunk &chunk);
+    void free(const EventPoolSlabChunk &chunk);
+
+    size_t getSlabSize() const { return slabSize; }
+    size_t getMaxChunkSize() const { return slabSize / 4; }
+    void getStatistics(EventPoolSlabStatistics &statistics) const;
+
+  protected:
+    struct Slab {
+        std::unique_ptr<NEO::MultiGraphicsAllocation> allocations;
+        RootDeviceIndicesContainer rootDeviceIndices;
+        NEO::AllocationType allocationType = NEO::AllocationType::UNKNOWN;
+        void *hostPtr = nullptr;
+        size_t usedSize = 0u;
+        size_t chunksInUse = 0u;
+        std::array<std::vector<size_t>, numSizeClasses> freeChunks;
+    };
+
+    static uint32_t getSizeClass(size_t size);
+    static size_t getSizeClassSize(uint32_t sizeClass) { return minChunkSize << sizeClass; }
+
+    bool allocateFromSlab(Slab &slab, uint32_t sizeClass, EventPoolSlabChunk &chunk);
+    MOCKABLE_VIRTUAL Slab *createSlab(const RootDeviceIndicesContainer &rootDeviceIndices, NEO::AllocationType allocationType);
+    bool isOtherSlabEmpty(const Slab &slab) const;
+    void resetSlab(Slab &slab);
+    void freeSlab(Slab &slab);
+
+    NEO::MemoryManager *memoryManager = nullptr;
+    const size_t slabSize;
+
+    std::vector<std::unique_ptr<Slab>> slabs;
+    EventPoolSlabStatistics statistics;
+    mutable std::mutex mtx;
+};
+
+} // namespace L0
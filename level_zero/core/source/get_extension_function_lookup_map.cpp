@@ -18,6 +18,10 @@ std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
     addToMap(lookupMap, zexDriverReleaseImportedPointer);
     addToMap(lookupMap, zexDriverGetHostPointerBaseAddress);
 
+    addToMap(lookupMap, zexDeviceGetIoctlStatistics);
+
+    addToMap(lookupMap, zexEventsHostSynchronize);
+
     addToMap(lookupMap, zexKernelGetBaseAddress);
 
     addToMap(lookupMap, zexMemGetIpcHandles);
@@ -40,6 +40,12 @@ void PageFaultManager::transferToGpu(void *ptr, void *device) {
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
 }
+void PageFaultManager::transferRangesToGpu(void *allocPtr, const std::vector<MemoryRange> &ranges, void *device) {
+    this->transferToGpu(allocPtr, device);
+}
+bool PageFaultManager::isChunkedMigrationSupported() const {
+    return false;
+}
 } // namespace NEO
 
 namespace L0 {
@@ -518,5 +518,36 @@ TEST_F(EventAssertTest, GivenEventSignalledWhenHostSynchronizeIsCalledThenAssert
     EXPECT_EQ(1u, assertHandler->printAssertAndAbortCalled);
 }
 
+TEST_F(EventAssertTest, GivenGpuHangWhenHostSynchronizingEventsThenAssertIsChecked) {
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->isGpuHangDetectedReturnValue = true;
+
+    event->csrs[0] = csr.get();
+    event->gpuHangCheckPeriod = std::chrono::microseconds::zero();
+    auto assertHandler = new MockAssertHandler(device->getNEODevice());
+    neoDevice->getRootDeviceEnvironmentRef().assertHandler.reset(assertHandler);
+
+    L0::Event *events[] = {event.get()};
+    auto result = L0::Event::hostSynchronizeEvents(1u, events, true, std::numeric_limits<std::uint64_t>::max(), nullptr, nullptr);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, result);
+    EXPECT_EQ(1u, assertHandler->printAssertAndAbortCalled);
+}
+
+TEST_F(EventAssertTest, GivenTimeoutWhenHostSynchronizingEventsThenAssertIsChecked) {
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->isGpuHangDetectedReturnValue = false;
+
+    event->csrs[0] = csr.get();
+    auto assertHandler = new MockAssertHandler(device->getNEODevice());
+    neoDevice->getRootDeviceEnvironmentRef().assertHandler.reset(assertHandler);
+
+    L0::Event *events[] = {event.get()};
+    auto result = L0::Event::hostSynchronizeEvents(1u, events, true, 0u, nullptr, nullptr);
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, result);
+    EXPECT_EQ(1u, assertHandler->printAssertAndAbortCalled);
+}
+
 } // namespace ult
 } // namespace L0
@@ -10,6 +10,8 @@
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/memory_management.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
+#include "shared/test/common/mocks/mock_builtins.h"
+#include "shared/test/common/mocks/mock_builtinslib.h"
 #include "shared/test/common/mocks/mock_compiler_interface_spirv.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -146,6 +148,82 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, whenCreateBuiltinFunctionsLibThenImmediate
     MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
 }
 
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenWarmUpBuiltinsAsyncEnabledWhenCreateBuiltinFunctionsLibThenCommonCopyAndFillBuiltinsAreLoaded) {
+    struct MockBuiltinFunctionsLibImpl : public BuiltinFunctionsLibImpl {
+        using BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl;
+        using BuiltinFunctionsLibImpl::builtins;
+        using BuiltinFunctionsLibImpl::initAsyncComplete;
+    };
+
+    DebugManagerStateRestore dbgRestorer;
+    NEO::DebugManager.flags.WarmUpBuiltinsAsync.set(1);
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.useinitBuiltinsAsyncEnabled = true;
+    MockBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+    EXPECT_FALSE(lib.initAsyncComplete);
+
+    const Builtin expectedBuiltins[] = {
+        Builtin::CopyBufferBytes,
+        Builtin::CopyBufferToBufferMiddle,
+        Builtin::CopyBufferToBufferSide,
+        Builtin::FillBufferImmediate,
+        Builtin::FillBufferImmediateLeftOver,
+        Builtin::FillBufferMiddle,
+        Builtin::FillBufferRightLeftover};
+    EXPECT_EQ(sizeof(expectedBuiltins) / sizeof(expectedBuiltins[0]), lib.getWarmedUpBuiltinsCount());
+    EXPECT_TRUE(lib.initAsyncComplete);
+    for (auto builtin : expectedBuiltins) {
+        EXPECT_NE(nullptr, lib.builtins[static_cast<uint32_t>(builtin)]);
+        EXPECT_TRUE(lib.isBuiltinWarmedUp(builtin));
+    }
+    EXPECT_EQ(nullptr, lib.builtins[static_cast<uint32_t>(Builtin::CopyBufferBytesStateless)]);
+    EXPECT_FALSE(lib.isBuiltinWarmedUp(Builtin::CopyBufferBytesStateless));
+    EXPECT_EQ(nullptr, lib.builtins[static_cast<uint32_t>(Builtin::QueryKernelTimestamps)]);
+    EXPECT_FALSE(lib.isBuiltinWarmedUp(Builtin::QueryKernelTimestamps));
+
+    /* std::async may create a detached thread - completion of the scheduled task can be ensured,
+       but there is no way to ensure that actual OS thread exited and its resources are freed */
+    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenWarmUpBuiltinsAsyncEnabledAndAsyncInitNotSupportedWhenCreateBuiltinFunctionsLibThenNoBuiltinIsLoadedAsynchronously) {
+    struct MockBuiltinFunctionsLibImpl : public BuiltinFunctionsLibImpl {
+        using BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl;
+        using BuiltinFunctionsLibImpl::builtins;
+        using BuiltinFunctionsLibImpl::initAsyncComplete;
+    };
+
+    DebugManagerStateRestore dbgRestorer;
+    NEO::DebugManager.flags.WarmUpBuiltinsAsync.set(1);
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.useinitBuiltinsAsyncEnabled = false;
+    MockBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+    EXPECT_TRUE(lib.initAsyncComplete);
+    EXPECT_EQ(0u, lib.getWarmedUpBuiltinsCount());
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+        EXPECT_EQ(nullptr, lib.builtins[builtId]);
+    }
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenWarmUpBuiltinsAsyncDisabledWhenCreateBuiltinFunctionsLibThenNoBuiltinIsLoadedAsynchronously) {
+    struct MockBuiltinFunctionsLibImpl : public BuiltinFunctionsLibImpl {
+        using BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl;
+        using BuiltinFunctionsLibImpl::builtins;
+        using BuiltinFunctionsLibImpl::initAsyncComplete;
+    };
+
+    DebugManagerStateRestore dbgRestorer;
+    NEO::DebugManager.flags.WarmUpBuiltinsAsync.set(0);
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.useinitBuiltinsAsyncEnabled = true;
+    MockBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+    EXPECT_TRUE(lib.initAsyncComplete);
+    EXPECT_EQ(0u, lib.getWarmedUpBuiltinsCount());
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+        EXPECT_EQ(nullptr, lib.builtins[builtId]);
+    }
+}
+
 HWTEST_F(TestBuiltinFunctionsLibImpl, givenCompilerInterfaceWhenCreateDeviceAndImageSupportedThenBuiltinsImageFunctionsAreLoaded) {
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
     neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->compilerInterface.reset(new NEO::MockCompilerInterfaceSpirv());
@@ -273,5 +351,27 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, GivenBuiltinsWhenInitializingFunctionsThen
     EXPECT_EQ(ModuleType::Builtin, testDevice.typeCreated);
 }
 
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenModuleOfBuiltinAlreadyCreatedWhenLoadingAnotherKernelFromSameBuiltinThenBuiltinCodeIsNotFetchedAgain) {
+    NEO::MockBuiltins mockBuiltins;
+    auto mockBuiltinsLib = new MockBuiltinsLib();
+    mockBuiltins.builtinsLib.reset(mockBuiltinsLib);
+
+    BuiltinFunctionsLibImpl builtinFunctionsLib(device, &mockBuiltins);
+    builtinFunctionsLib.ensureInitCompletion();
+    auto getBuiltinCodeCalledBefore = mockBuiltinsLib->getBuiltinCodeCalled;
+
+    builtinFunctionsLib.initBuiltinKernel(Builtin::CopyBufferToBufferSide);
+    auto getBuiltinCodeCalledForModule = mockBuiltinsLib->getBuiltinCodeCalled;
+    EXPECT_LT(getBuiltinCodeCalledBefore, getBuiltinCodeCalledForModule);
+
+    builtinFunctionsLib.initBuiltinKernel(Builtin::CopyBufferToBufferMiddle);
+    builtinFunctionsLib.initBuiltinKernel(Builtin::CopyBufferBytes);
+    EXPECT_EQ(getBuiltinCodeCalledForModule, mockBuiltinsLib->getBuiltinCodeCalled);
+
+    EXPECT_NE(nullptr, builtinFunctionsLib.getFunction(Builtin::CopyBufferToBufferSide));
+    EXPECT_NE(nullptr, builtinFunctionsLib.getFunction(Builtin::CopyBufferToBufferMiddle));
+    EXPECT_NE(nullptr, builtinFunctionsLib.getFunction(Builtin::CopyBufferBytes));
+}
+
 } // namespace ult
 } // namespace L0
@@ -27,12 +27,14 @@
 #include "shared/test/common/mocks/mock_compilers.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_driver_info.h"
+#include "shared/test/common/mocks/mock_driver_model.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/mocks/mock_os_context.h"
 #include "shared/test/common/mocks/mock_sip.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_device.h"
 #include "level_zero/core/source/cache/cache_reservation.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/context/context_imp.h"
@@ -4538,5 +4540,70 @@ TEST(DeviceReturnSubDevicesAsApiDevicesTest, GivenReturnSubDevicesAsApiDevicesIs
     multiDeviceFixture.tearDown();
 }
 
+using DeviceIoctlStatisticsTest = Test<DeviceFixture>;
+
+TEST_F(DeviceIoctlStatisticsTest, givenNoStatisticsCollectedWhenGettingIoctlStatisticsThenUnsupportedFeatureIsReturned) {
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, L0::zexDeviceGetIoctlStatistics(device->toHandle(), nullptr, nullptr));
+
+    neoDevice->executionEnvironment->rootDeviceEnvironments[0]->osInterface.reset();
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, L0::zexDeviceGetIoctlStatistics(device->toHandle(), &count, nullptr));
+
+    neoDevice->executionEnvironment->rootDeviceEnvironments[0]->osInterface.reset(new NEO::OSInterface);
+    neoDevice->executionEnvironment->rootDeviceEnvironments[0]->osInterface->setDriverModel(std::make_unique<NEO::MockDriverModel>());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, L0::zexDeviceGetIoctlStatistics(device->toHandle(), &count, nullptr));
+}
+
+TEST_F(DeviceIoctlStatisticsTest, givenStatisticsCollectedWhenGettingIoctlStatisticsThenEntriesAreCopiedWithMostFrequentErrorCodesFirst) {
+    auto driverModel = new NEO::MockDriverModel();
+    driverModel->driverCallStatisticsAvailable = true;
+    driverModel->driverCallStatistics.resize(2);
+    auto &first = driverModel->driverCallStatistics[0];
+    first.name = "DRM_IOCTL_I915_GEM_EXECBUFFER2";
+    first.count = 10;
+    first.totalTime = 1000;
+    first.minTime = 50;
+    first.maxTime = 300;
+    first.p50Time = 127;
+    first.p90Time = 255;
+    first.p99Time = 300;
+    first.errorCount = 4;
+    first.errorCodes = {{ENOMEM, 1}, {EBUSY, 3}};
+    driverModel->driverCallStatistics[1].name = std::string(2 * ZEX_MAX_IOCTL_NAME_SIZE, 'a');
+    neoDevice->executionEnvironment->rootDeviceEnvironments[0]->osInterface.reset(new NEO::OSInterface);
+    neoDevice->executionEnvironment->rootDeviceEnvironments[0]->osInterface->setDriverModel(std::unique_ptr<NEO::DriverModel>(driverModel));
+
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexDeviceGetIoctlStatistics(device->toHandle(), &count, nullptr));
+    EXPECT_EQ(2u, count);
+
+    zex_ioctl_statistics_t statistics[3] = {};
+    count = 3;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexDeviceGetIoctlStatistics(device->toHandle(), &count, statistics));
+    EXPECT_EQ(2u, count);
+
+    EXPECT_STREQ("DRM_IOCTL_I915_GEM_EXECBUFFER2", statistics[0].name);
+    EXPECT_EQ(10u, statistics[0].count);
+    EXPECT_EQ(1000u, statistics[0].totalTime);
+    EXPECT_EQ(50u, statistics[0].minTime);
+    EXPECT_EQ(300u, statistics[0].maxTime);
+    EXPECT_EQ(127u, statistics[0].p50Time);
+    EXPECT_EQ(255u, statistics[0].p90Time);
+    EXPECT_EQ(300u, statistics[0].p99Time);
+    EXPECT_EQ(4u, statistics[0].errorCount);
+    ASSERT_EQ(2u, statistics[0].errorCodeCount);
+    EXPECT_EQ(EBUSY, statistics[0].errorCodes[0]);
+    EXPECT_EQ(3u, statistics[0].errorCodeOccurrences[0]);
+    EXPECT_EQ(ENOMEM, statistics[0].errorCodes[1]);
+    EXPECT_EQ(1u, statistics[0].errorCodeOccurrences[1]);
+
+    EXPECT_EQ(static_cast<size_t>(ZEX_MAX_IOCTL_NAME_SIZE - 1), strlen(statistics[1].name));
+    EXPECT_EQ(0u, statistics[1].errorCodeCount);
+
+    count = 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexDeviceGetIoctlStatistics(device->toHandle(), &count, statistics));
+    EXPECT_EQ(1u, count);
+}
+
 } // namespace ult
 } // namespace L0
@@ -863,6 +863,8 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     decltype(&zexDriverReleaseImportedPointer) expectedRelease = L0::zexDriverReleaseImportedPointer;
     decltype(&zexDriverGetHostPointerBaseAddress) expectedGet = L0::zexDriverGetHostPointerBaseAddress;
     decltype(&zexKernelGetBaseAddress) expectedKernelGetBaseAddress = L0::zexKernelGetBaseAddress;
+    decltype(&zexDeviceGetIoctlStatistics) expectedDeviceGetIoctlStatistics = L0::zexDeviceGetIoctlStatistics;
+    decltype(&zexEventsHostSynchronize) expectedEventsHostSynchronize = L0::zexEventsHostSynchronize;
 
     void *funPtr = nullptr;
 
@@ -881,6 +883,14 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexKernelGetBaseAddress", &funPtr);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
     EXPECT_EQ(expectedKernelGetBaseAddress, reinterpret_cast<decltype(&zexKernelGetBaseAddress)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexDeviceGetIoctlStatistics", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedDeviceGetIoctlStatistics, reinterpret_cast<decltype(&zexDeviceGetIoctlStatistics)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexEventsHostSynchronize", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedEventsHostSynchronize, reinterpret_cast<decltype(&zexEventsHostSynchronize)>(funPtr));
 }
 
 TEST_F(DriverExperimentalApiTest, givenHostPointerApiExistWhenImportingPtrThenExpectProperBehavior) {
@@ -19,6 +19,7 @@
 #include "shared/test/common/mocks/mock_timestamp_packet.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_event.h"
 #include "level_zero/core/source/context/context_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event.h"
@@ -1547,6 +1548,116 @@ TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutZeroWhenO
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+struct EventsHostSynchronizeTest : public EventSynchronizeTest {
+    void SetUp() override {
+        EventSynchronizeTest::SetUp();
+        event->setUsingContextEndOffset(false);
+        for (uint32_t i = 1; i < numEvents; i++) {
+            ze_event_desc_t desc = eventDesc;
+            desc.index = i;
+            additionalEvents.emplace_back(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &desc, device)));
+            additionalEvents.back()->setUsingContextEndOffset(false);
+        }
+        events = {event.get(), additionalEvents[0].get(), additionalEvents[1].get()};
+    }
+
+    void TearDown() override {
+        additionalEvents.clear();
+        EventSynchronizeTest::TearDown();
+    }
+
+    void signal(L0::Event *eventToSignal) {
+        *static_cast<uint32_t *>(eventToSignal->getHostAddress()) = Event::STATE_SIGNALED;
+    }
+
+    static constexpr uint32_t numEvents = 3;
+    std::vector<std::unique_ptr<EventImp<uint32_t>>> additionalEvents;
+    std::vector<L0::Event *> events;
+};
+
+TEST_F(EventsHostSynchronizeTest, givenWaitAllAndNotAllEventsSignaledWhenSynchronizingWithZeroTimeoutThenNotReadyIsReturnedAfterSinglePass) {
+    signal(events[0]);
+    signal(events[2]);
+
+    EventsWaitStatistics statistics{};
+    auto result = L0::Event::hostSynchronizeEvents(numEvents, events.data(), true, 0, nullptr, &statistics);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, result);
+    EXPECT_EQ(1u, statistics.pollPasses);
+    EXPECT_EQ(0u, statistics.sleepCount);
+
+    signal(events[1]);
+    result = L0::Event::hostSynchronizeEvents(numEvents, events.data(), true, 0, nullptr, &statistics);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, statistics.pollPasses);
+}
+
+TEST_F(EventsHostSynchronizeTest, givenWaitAnyWhenOneEventIsSignaledThenSuccessAndIndexOfSignaledEventAreReturned) {
+    signal(events[2]);
+
+    uint32_t signaledIndex = 0;
+    auto result = L0::Event::hostSynchronizeEvents(numEvents, events.data(), false, 0, &signaledIndex, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(2u, signaledIndex);
+
+    result = L0::Event::hostSynchronizeEvents(numEvents, events.data(), true, 0, nullptr, nullptr);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, result);
+}
+
+TEST_F(EventsHostSynchronizeTest, givenEventSignaledWhileSpinningWhenWaitingForAllEventsThenSuccessIsReturnedAfterFurtherPass) {
+    signal(events[0]);
+    signal(events[2]);
+
+    VariableBackup<volatile TagAddressType *> backupPauseAddress(&CpuIntrinsicsTests::pauseAddress);
+    VariableBackup<TaskCountType> backupPauseValue(&CpuIntrinsicsTests::pauseValue, Event::STATE_SIGNALED);
+    VariableBackup<std::function<void()>> backupSetupPauseAddress(&CpuIntrinsicsTests::setupPauseAddress);
+    CpuIntrinsicsTests::pauseAddress = static_cast<TagAddressType *>(events[1]->getHostAddress());
+    CpuIntrinsicsTests::setupPauseAddress = []() {};
+
+    EventsWaitStatistics statistics{};
+    auto result = L0::Event::hostSynchronizeEvents(numEvents, events.data(), true, std::numeric_limits<uint64_t>::max(), nullptr, &statistics);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(2u, statistics.pollPasses);
+    EXPECT_LE(statistics.maxWakeupLatency, statistics.waitTime);
+}
+
+TEST_F(EventsHostSynchronizeTest, givenSpinBudgetUsedWhenWaitingForEventsThenWaitSleepsUntilTimeout) {
+    NEO::DebugManager.flags.EventsWaitSpinBudgetUs.set(0);
+    NEO::DebugManager.flags.EventsWaitMaxSleepUs.set(1);
+
+    EventsWaitStatistics statistics{};
+    auto result = L0::Event::hostSynchronizeEvents(numEvents, events.data(), false, 100'000, nullptr, &statistics);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, result);
+    EXPECT_LT(0u, statistics.sleepCount);
+    EXPECT_EQ(statistics.sleepCount + 1, statistics.pollPasses);
+    EXPECT_GE(statistics.waitTime, 100'000u);
+}
+
+TEST_F(EventsHostSynchronizeTest, givenGpuHangWhenWaitingForEventsThenDeviceLostIsReturned) {
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->isGpuHangDetectedReturnValue = true;
+
+    additionalEvents[1]->csrs[0] = csr.get();
+    event->gpuHangCheckPeriod = 0ms;
+
+    auto result = L0::Event::hostSynchronizeEvents(numEvents, events.data(), true, std::numeric_limits<uint64_t>::max(), nullptr, nullptr);
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, result);
+}
+
+TEST_F(EventsHostSynchronizeTest, givenInvalidArgumentsWhenCallingExperimentalEventsHostSynchronizeThenErrorIsReturned) {
+    std::vector<ze_event_handle_t> handles = {events[0]->toHandle(), events[1]->toHandle(), events[2]->toHandle()};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexEventsHostSynchronize(numEvents, nullptr, ZEX_EVENT_WAIT_MODE_ALL, 0, nullptr, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zexEventsHostSynchronize(0, handles.data(), ZEX_EVENT_WAIT_MODE_ALL, 0, nullptr, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ENUMERATION, zexEventsHostSynchronize(numEvents, handles.data(), ZEX_EVENT_WAIT_MODE_FORCE_UINT32, 0, nullptr, nullptr));
+
+    signal(events[1]);
+    uint32_t signaledIndex = 0;
+    zex_event_wait_statistics_t statistics{};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventsHostSynchronize(numEvents, handles.data(), ZEX_EVENT_WAIT_MODE_ANY, 0, &signaledIndex, &statistics));
+    EXPECT_EQ(1u, signaledIndex);
+    EXPECT_EQ(1u, statistics.pollPasses);
+}
+
 TEST_F(EventUsedPacketSignalSynchronizeTest, givenInfiniteTimeoutWhenWaitingForNonTimestampEventCompletionThenReturnOnlyAfterAllEventPacketsAreCompleted) {
     constexpr uint32_t packetsInUse = 2;
     event->setPacketsInUse(packetsInUse);
@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "level_zero/core/source/context/context_imp.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
+#include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
+#include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+
+#include <memory>
+#include <vector>
+
+namespace L0 {
+namespace ult {
+
+class MockEventPoolSlabAllocator : public EventPoolSlabAllocator {
+  public:
+    using EventPoolSlabAllocator::EventPoolSlabAllocator;
+    using EventPoolSlabAllocator::slabs;
+
+    Slab *createSlab(const RootDeviceIndicesContainer &rootDeviceIndices, NEO::AllocationType allocationType) override {
+        createSlabCalled++;
+        if (failCreateSlab) {
+            return nullptr;
+        }
+        return EventPoolSlabAllocator::createSlab(rootDeviceIndices, allocationType);
+    }
+
+    uint32_t createSlabCalled = 0u;
+    bool failCreateSlab = false;
+};
+
+struct EventPoolSlabAllocatorFixture : public DeviceFixture {
+    void setUp() {
+        DebugManager.flags.EnableEventPoolSlabAllocator.set(1);
+        DebugManager.flags.EventPoolSlabSize.set(slabSize);
+        DeviceFixture::setUp();
+        rootDeviceIndices.push_back(device->getNEODevice()->getRootDeviceIndex());
+    }
+
+    void tearDown() {
+        DeviceFixture::tearDown();
+    }
+
+    EventPool *createHostVisibleEventPool(uint32_t count, ze_event_pool_flags_t flags) {
+        ze_event_pool_desc_t eventPoolDesc = {};
+        eventPoolDesc.count = count;
+        eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE | flags;
+
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        auto eventPool = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+        return eventPool;
+    }
+
+    static constexpr int64_t slabSize = 16 * MemoryConstants::pageSize;
+    DebugManagerStateRestore restorer;
+    RootDeviceIndicesContainer rootDeviceIndices;
+};
+
+using EventPoolSlabAllocatorTest = Test<EventPoolSlabAllocatorFixture>;
+
+TEST_F(EventPoolSlabAllocatorTest, givenEnableEventPoolSlabAllocatorDebugKeyWhenDriverHandleIsInitializedThenSlabAllocatorIsCreated) {
+    ASSERT_NE(nullptr, driverHandle->eventPoolSlabAllocator);
+    EXPECT_EQ(static_cast<size_t>(slabSize), driverHandle->eventPoolSlabAllocator->getSlabSize());
+    EXPECT_EQ(static_cast<size_t>(slabSize / 4), driverHandle->eventPoolSlabAllocator->getMaxChunkSize());
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenSlabAllocatorWhenAllocatingChunksThenChunksAreSizedToPowerOfTwoAndPlacedInOneSlab) {
+    MockEventPoolSlabAllocator slabAllocator(driverHandle->getMemoryManager(), slabSize);
+
+    EventPoolSlabChunk firstChunk;
+    EventPoolSlabChunk secondChunk;
+    ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 100u, 64u, firstChunk));
+    ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, MemoryConstants::pageSize + 1, 64u, secondChunk));
+
+    EXPECT_EQ(1u, slabAllocator.createSlabCalled);
+    EXPECT_EQ(firstChunk.allocations, secondChunk.allocations);
+    EXPECT_EQ(0u, firstChunk.offset);
+    EXPECT_EQ(MemoryConstants::pageSize, firstChunk.size);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, secondChunk.offset);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, secondChunk.size);
+
+    EventPoolSlabStatistics statistics;
+    slabAllocator.getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.slabsAllocated);
+    EXPECT_EQ(2u, statistics.chunksAllocated);
+    EXPECT_EQ(2u, statistics.chunksInUse);
+
+    slabAllocator.free(firstChunk);
+    slabAllocator.free(secondChunk);
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenFreedChunkWhenAllocatingChunkOfSameSizeClassThenChunkIsReusedAndZeroed) {
+    MockEventPoolSlabAllocator slabAllocator(driverHandle->getMemoryManager(), slabSize);
+
+    EventPoolSlabChunk usedChunk;
+    ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 100u, 64u, usedChunk));
+    EventPoolSlabChunk chunk;
+    ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 256u, 64u, chunk));
+    auto hostPtr = ptrOffset(chunk.allocations->getDefaultGraphicsAllocation()->getUnderlyingBuffer(), chunk.offset);
+    memset(hostPtr, 0xff, chunk.size);
+    slabAllocator.free(chunk);
+
+    EventPoolSlabChunk reusedChunk;
+    ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 512u, 64u, reusedChunk));
+    EXPECT_EQ(chunk.allocations, reusedChunk.allocations);
+    EXPECT_EQ(chunk.offset, reusedChunk.offset);
+    EXPECT_EQ(0u, *reinterpret_cast<uint32_t *>(hostPtr));
+    EXPECT_EQ(0u, *reinterpret_cast<uint32_t *>(ptrOffset(hostPtr, reusedChunk.size - sizeof(uint32_t))));
+
+    EventPoolSlabStatistics statistics;
+    slabAllocator.getStatistics(statistics);
+    EXPECT_EQ(2u, statistics.chunksAllocated);
+    EXPECT_EQ(1u, statistics.chunksReused);
+    EXPECT_EQ(2u, statistics.chunksInUse);
+
+    slabAllocator.free(reusedChunk);
+    slabAllocator.free(usedChunk);
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenSlabWithAllChunksFreedWhenAllocatingChunkOfOtherSizeClassThenSlabIsCarvedAgainFromStart) {
+    MockEventPoolSlabAllocator slabAllocator(driverHandle->getMemoryManager(), slabSize);
+
+    EventPoolSlabChunk chunk;
+    ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 100u, 64u, chunk));
+    auto hostPtr = ptrOffset(chunk.allocations->getDefaultGraphicsAllocation()->getUnderlyingBuffer(), chunk.offset);
+    memset(hostPtr, 0xff, chunk.size);
+    slabAllocator.free(chunk);
+
+    EventPoolSlabChunk largerChunk;
+    ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 4 * MemoryConstants::pageSize, 64u, largerChunk));
+    EXPECT_EQ(1u, slabAllocator.createSlabCalled);
+    EXPECT_EQ(chunk.allocations, largerChunk.allocations);
+    EXPECT_EQ(0u, largerChunk.offset);
+    EXPECT_EQ(0u, *reinterpret_cast<uint32_t *>(hostPtr));
+
+    slabAllocator.free(largerChunk);
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenDifferentAllocationTypesOrFullSlabWhenAllocatingChunksThenNewSlabIsCreated) {
+    MockEventPoolSlabAllocator slabAllocator(driverHandle->getMemoryManager(), slabSize);
+    std::vector<EventPoolSlabChunk> chunks(6);
+
+    ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 4 * MemoryConstants::pageSize, 64u, chunks[0]));
+    ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER, 4 * MemoryConstants::pageSize, 64u, chunks[1]));
+    EXPECT_EQ(2u, slabAllocator.createSlabCalled);
+    EXPECT_NE(chunks[0].allocations, chunks[1].allocations);
+
+    for (uint32_t i = 2; i < 5; i++) {
+        ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 4 * MemoryConstants::pageSize, 64u, chunks[i]));
+        EXPECT_EQ(chunks[0].allocations, chunks[i].allocations);
+    }
+    EXPECT_EQ(2u, slabAllocator.createSlabCalled);
+
+    ASSERT_TRUE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 4 * MemoryConstants::pageSize, 64u, chunks[5]));
+    EXPECT_EQ(3u, slabAllocator.createSlabCalled);
+    EXPECT_EQ(0u, chunks[5].offset);
+    EXPECT_EQ(3u, slabAllocator.slabs.size());
+
+    for (auto &chunk : chunks) {
+        slabAllocator.free(chunk);
+    }
+    EXPECT_EQ(1u, slabAllocator.slabs.size());
+
+    EventPoolSlabStatistics statistics;
+    slabAllocator.getStatistics(statistics);
+    EXPECT_EQ(3u, statistics.slabsAllocated);
+    EXPECT_EQ(2u, statistics.slabsReleased);
+    EXPECT_EQ(0u, statistics.chunksInUse);
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenTooLargeSizeOrAlignmentOrSlabCreationFailureWhenAllocatingChunkThenFalseIsReturned) {
+    MockEventPoolSlabAllocator slabAllocator(driverHandle->getMemoryManager(), slabSize);
+    EventPoolSlabChunk chunk;
+
+    EXPECT_FALSE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 0u, 64u, chunk));
+    EXPECT_FALSE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, slabAllocator.getMaxChunkSize() + 1, 64u, chunk));
+    EXPECT_FALSE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 64u, MemoryConstants::pageSize64k, chunk));
+    EXPECT_EQ(0u, slabAllocator.createSlabCalled);
+
+    slabAllocator.failCreateSlab = true;
+    EXPECT_FALSE(slabAllocator.allocate(rootDeviceIndices, NEO::AllocationType::BUFFER_HOST_MEMORY, 64u, 64u, chunk));
+    EXPECT_EQ(1u, slabAllocator.createSlabCalled);
+    EXPECT_EQ(nullptr, chunk.allocations);
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenSlabAllocatorWhenCreatingHostVisibleEventPoolThenEventsAreAddressedWithinSlabChunk) {
+    std::unique_ptr<EventPool> firstEventPool(createHostVisibleEventPool(2, 0));
+    std::unique_ptr<EventPool> eventPool(createHostVisibleEventPool(2, 0));
+    ASSERT_NE(nullptr, firstEventPool);
+    ASSERT_NE(nullptr, eventPool);
+    ASSERT_TRUE(eventPool->isSlabAllocated());
+    EXPECT_NE(0u, eventPool->getAllocationOffset());
+    EXPECT_EQ(&firstEventPool->getAllocation(), &eventPool->getAllocation());
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 1;
+    auto &l0GfxCoreHelper = device->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
+    std::unique_ptr<L0::Event> event(l0GfxCoreHelper.createEvent(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, event);
+
+    auto slabAllocation = eventPool->getAllocation().getGraphicsAllocation(device->getNEODevice()->getRootDeviceIndex());
+    auto expectedOffset = eventPool->getAllocationOffset() + eventPool->getEventSize();
+    EXPECT_EQ(slabAllocation, &event->getAllocation(device));
+    EXPECT_EQ(slabAllocation->getGpuAddress() + expectedOffset, event->getGpuAddress(device));
+    EXPECT_EQ(ptrOffset(slabAllocation->getUnderlyingBuffer(), expectedOffset), event->getHostAddress());
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    event->hostSignal();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    event->reset();
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenDestroyedEventPoolWhenCreatingNewEventPoolThenSlabChunkIsRecycledAndEventIsReset) {
+    auto &l0GfxCoreHelper = device->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+
+    std::unique_ptr<EventPool> usedEventPool(createHostVisibleEventPool(4, 0));
+    auto eventPool = createHostVisibleEventPool(4, 0);
+    ASSERT_NE(nullptr, eventPool);
+    auto offset = eventPool->getAllocationOffset();
+    auto event = l0GfxCoreHelper.createEvent(eventPool, &eventDesc, device);
+    event->hostSignal();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    event->destroy();
+    eventPool->destroy();
+
+    eventPool = createHostVisibleEventPool(4, 0);
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_EQ(offset, eventPool->getAllocationOffset());
+    event = l0GfxCoreHelper.createEvent(eventPool, &eventDesc, device);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    event->destroy();
+    eventPool->destroy();
+
+    EventPoolSlabStatistics statistics;
+    driverHandle->eventPoolSlabAllocator->getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.slabsAllocated);
+    EXPECT_EQ(1u, statistics.chunksReused);
+    EXPECT_EQ(1u, statistics.chunksInUse);
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenIpcOrDeviceOrLargeEventPoolWhenCreatingEventPoolThenDedicatedAllocationIsUsed) {
+    std::unique_ptr<EventPool> ipcEventPool(createHostVisibleEventPool(1, ZE_EVENT_POOL_FLAG_IPC));
+    ASSERT_NE(nullptr, ipcEventPool);
+    EXPECT_FALSE(ipcEventPool->isSlabAllocated());
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 1;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<EventPool> deviceEventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_NE(nullptr, deviceEventPool);
+    EXPECT_FALSE(deviceEventPool->isSlabAllocated());
+
+    uint32_t largeCount = static_cast<uint32_t>(driverHandle->eventPoolSlabAllocator->getMaxChunkSize() / ipcEventPool->getEventSize()) + 1;
+    std::unique_ptr<EventPool> largeEventPool(createHostVisibleEventPool(largeCount, 0));
+    ASSERT_NE(nullptr, largeEventPool);
+    EXPECT_FALSE(largeEventPool->isSlabAllocated());
+    EXPECT_EQ(0u, largeEventPool->getAllocationOffset());
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenManySmallEventPoolsCreatedAndDestroyedWhenSlabAllocatorIsUsedThenSingleSlabIsAllocatedAndKept) {
+    constexpr uint32_t numIterations = 16u;
+
+    for (uint32_t i = 0; i < numIterations; i++) {
+        auto eventPool = createHostVisibleEventPool(8, 0);
+        ASSERT_NE(nullptr, eventPool);
+        EXPECT_TRUE(eventPool->isSlabAllocated());
+        EXPECT_EQ(0u, eventPool->getAllocationOffset());
+        eventPool->destroy();
+    }
+
+    EventPoolSlabStatistics statistics;
+    driverHandle->eventPoolSlabAllocator->getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.slabsAllocated);
+    EXPECT_EQ(0u, statistics.slabsReleased);
+    EXPECT_EQ(numIterations, statistics.chunksAllocated);
+    EXPECT_EQ(0u, statistics.chunksInUse);
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenSlabAllocatorReleasedBeforeEventPoolWhenDestroyingEventPoolThenPoolIsDestroyed) {
+    auto eventPool = createHostVisibleEventPool(2, 0);
+    ASSERT_NE(nullptr, eventPool);
+    ASSERT_TRUE(eventPool->isSlabAllocated());
+
+    driverHandle->eventPoolSlabAllocator.reset();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool->destroy());
+}
+
+HWTEST_F(EventPoolSlabAllocatorTest, givenCsrInTbxModeWhenCreatingSlabAllocatedEventPoolThenSlabAllocationIsWriteMemoryOnly) {
+    neoDevice->getUltCommandStreamReceiver<FamilyType>().commandStreamReceiverType = CommandStreamReceiverType::CSR_TBX;
+
+    std::unique_ptr<EventPool> eventPool(createHostVisibleEventPool(2, 0));
+    ASSERT_NE(nullptr, eventPool);
+    ASSERT_TRUE(eventPool->isSlabAllocated());
+    EXPECT_TRUE(eventPool->getAllocation().getDefaultGraphicsAllocation()->getAubInfo().writeMemoryOnly);
+}
+
+} // namespace ult
+} // namespace L0
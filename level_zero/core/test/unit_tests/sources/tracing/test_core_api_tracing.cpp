@@ -88,6 +88,26 @@ void onExitCommandListCloseWithUserDataRecursion(
     *val += 5;
 }
 
+void onEnterCommandListCloseStoringUserDataAsInstanceData(
+    ze_command_list_close_params_t *params,
+    ze_result_t result,
+    void *pTracerUserData,
+    void **ppTracerInstanceUserData) {
+    ASSERT_NE(nullptr, ppTracerInstanceUserData);
+    EXPECT_EQ(nullptr, *ppTracerInstanceUserData);
+    *ppTracerInstanceUserData = pTracerUserData;
+}
+void onExitCommandListCloseCountingMatchingInstanceData(
+    ze_command_list_close_params_t *params,
+    ze_result_t result,
+    void *pTracerUserData,
+    void **ppTracerInstanceUserData) {
+    ASSERT_NE(nullptr, ppTracerInstanceUserData);
+    ASSERT_EQ(pTracerUserData, *ppTracerInstanceUserData);
+    int *val = static_cast<int *>(pTracerUserData);
+    (*val)++;
+}
+
 void onEnterCommandListCloseWithUserDataAndAllocateInstanceData(
     ze_command_list_close_params_t *params,
     ze_result_t result,
@@ -302,6 +322,38 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(ZeApiTracingCoreTests, GivenMoreTracersThanOnStackCapacityWhenCallingTracerWrapperThenEachTracerGetsItsOwnInstanceData) {
+    MockCommandList commandList;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    ze_command_list_close_params_t tracerParams;
+
+    ze_command_list_handle_t commandListHandle = commandList.toHandle();
+    tracerParams.phCommandList = &commandListHandle;
+
+    constexpr size_t tracersCount = apiTracersOnStackCount + 2;
+    int userData[tracersCount] = {};
+
+    APITracerCallbacksContainer<ze_pfnCommandListCloseCb_t> prologCallbacks;
+    APITracerCallbacksContainer<ze_pfnCommandListCloseCb_t> epilogCallbacks;
+    for (size_t i = 0; i < tracersCount; i++) {
+        APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> prologCallback;
+        APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> epilogCallback;
+        prologCallback.currentApiCallback = onEnterCommandListCloseStoringUserDataAsInstanceData;
+        epilogCallback.currentApiCallback = onExitCommandListCloseCountingMatchingInstanceData;
+        prologCallback.pUserData = &userData[i];
+        epilogCallback.pUserData = &userData[i];
+        prologCallbacks.push_back(prologCallback);
+        epilogCallbacks.push_back(epilogCallback);
+    }
+    ze_pfnCommandListCloseCb_t apiOrdinal = {};
+
+    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, *tracerParams.phCommandList);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    for (size_t i = 0; i < tracersCount; i++) {
+        EXPECT_EQ(1, userData[i]);
+    }
+}
+
 TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsWithRecursionHandledThenSuccessIsReturned) {
     MockCommandList commandList;
     ze_result_t result = ZE_RESULT_SUCCESS;
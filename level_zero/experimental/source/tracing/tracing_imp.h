@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/stackvec.h"
+
 #include "level_zero/experimental/source/tracing/tracing.h"
 #include "level_zero/experimental/source/tracing/tracing_barrier_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_cmdlist_imp.h"
@@ -140,12 +142,17 @@ class APITracerCallbackStateImp {
     void *pUserData;
 };
 
+constexpr size_t apiTracersOnStackCount = 4;
+
+template <class T>
+using APITracerCallbacksContainer = StackVec<L0::APITracerCallbackStateImp<T>, apiTracersOnStackCount>;
+
 template <class T>
 class APITracerCallbackDataImp {
   public:
     T apiOrdinal = {};
-    std::vector<L0::APITracerCallbackStateImp<T>> prologCallbacks;
-    std::vector<L0::APITracerCallbackStateImp<T>> epilogCallbacks;
+    APITracerCallbacksContainer<T> prologCallbacks;
+    APITracerCallbacksContainer<T> epilogCallbacks;
 };
 
 #define ZE_HANDLE_TRACER_RECURSION(ze_api_ptr, ...) \
@@ -187,24 +194,22 @@ template <typename TFunction_pointer, typename TParams, typename TTracer, typena
 ze_result_t apiTracerWrapperImp(TFunction_pointer zeApiPtr,
                                 TParams paramsStruct,
                                 TTracer apiOrdinal,
-                                TTracerPrologCallbacks prologCallbacks,
-                                TTracerEpilogCallbacks epilogCallbacks,
+                                const TTracerPrologCallbacks &prologCallbacks,
+                                const TTracerEpilogCallbacks &epilogCallbacks,
                                 Args &&...args) {
     ze_result_t ret = ZE_RESULT_SUCCESS;
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksPrologs = &prologCallbacks;
 
-    std::vector<void *> ppTracerInstanceUserData;
-    ppTracerInstanceUserData.resize(callbacksPrologs->size());
+    StackVec<void *, apiTracersOnStackCount> ppTracerInstanceUserData;
+    ppTracerInstanceUserData.resize(prologCallbacks.size());
 
-    for (size_t i = 0; i < callbacksPrologs->size(); i++) {
-        if (callbacksPrologs->at(i).currentApiCallback != nullptr)
-            callbacksPrologs->at(i).currentApiCallback(paramsStruct, ret, callbacksPrologs->at(i).pUserData, &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < prologCallbacks.size(); i++) {
+        if (prologCallbacks[i].currentApiCallback != nullptr)
+            prologCallbacks[i].currentApiCallback(paramsStruct, ret, prologCallbacks[i].pUserData, &ppTracerInstanceUserData[i]);
     }
     ret = zeApiPtr(args...);
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs = &epilogCallbacks;
-    for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
-        if (callbacksEpilogs->at(i).currentApiCallback != nullptr)
-            callbacksEpilogs->at(i).currentApiCallback(paramsStruct, ret, callbacksEpilogs->at(i).pUserData, &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < epilogCallbacks.size(); i++) {
+        if (epilogCallbacks[i].currentApiCallback != nullptr)
+            epilogCallbacks[i].currentApiCallback(paramsStruct, ret, epilogCallbacks[i].pUserData, &ppTracerInstanceUserData[i]);
     }
     L0::tracingInProgress = 0;
     L0::pGlobalAPITracerContextImp->releaseActivetracersList();
@@ -7,10 +7,18 @@
 
 #include "level_zero/sysman/source/engine/sysman_engine_imp.h"
 
+#include "level_zero/sysman/source/sampler/sysman_sampler.h"
+
 namespace L0 {
 namespace Sysman {
 
 ze_result_t EngineImp::engineGetActivity(zes_engine_stats_t *pStats) {
+    SysmanSampleEntry entry = {};
+    if (pSampler != nullptr && pSampler->getLatestEntry(SysmanSampledCounter::engineActivity, samplerHandleIndex, entry)) {
+        pStats->activeTime = entry.values[0];
+        pStats->timestamp = entry.timestamp;
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsEngine->getActivity(pStats);
 }
 
@@ -14,6 +14,7 @@
 #include <level_zero/zes_api.h>
 namespace L0 {
 namespace Sysman {
+class SysmanSampler;
 
 class EngineImp : public Engine, NEO::NonCopyableOrMovableClass {
   public:
@@ -25,6 +26,8 @@ class EngineImp : public Engine, NEO::NonCopyableOrMovableClass {
     ~EngineImp() override;
 
     std::unique_ptr<OsEngine> pOsEngine;
+    SysmanSampler *pSampler = nullptr;
+    uint32_t samplerHandleIndex = 0;
     void init();
 
   private:
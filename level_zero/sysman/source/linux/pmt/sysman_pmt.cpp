@@ -23,48 +23,117 @@ const std::string PlatformMonitoringTech::baseTelemSysFS("/sys/class/intel_pmt")
 const std::string PlatformMonitoringTech::telem("telem");
 uint32_t PlatformMonitoringTech::rootDeviceTelemNodeIndex = 0;
 
+void PlatformMonitoringTech::closeTelemetryFd() {
+    std::lock_guard<std::mutex> lock(telemetryFdMutex);
+    if (telemetryFd >= 0) {
+        this->closeFunction(telemetryFd);
+        telemetryFd = -1;
+    }
+}
+
+ze_result_t PlatformMonitoringTech::readTelemetry(void *buffer, size_t size, uint64_t offset) {
+    // held across pread so that a failing reader cannot close the descriptor under a concurrent one
+    std::lock_guard<std::mutex> lock(telemetryFdMutex);
+    if (telemetryFd < 0) {
+        telemetryFd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
+        if (telemetryFd < 0) {
+            return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+        }
+    }
+    if (this->preadFunction(telemetryFd, buffer, size, baseOffset + offset) != static_cast<ssize_t>(size)) {
+        // drop the descriptor so that the next read reopens the telemetry file
+        this->closeFunction(telemetryFd);
+        telemetryFd = -1;
+        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
     auto offset = keyOffsetMap.find(key);
     if (offset == keyOffsetMap.end()) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
-    int fd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
-    if (fd == -1) {
-        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
-    }
+    return readTelemetry(&value, sizeof(uint32_t), offset->second);
+}
 
-    ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint32_t), baseOffset + offset->second) != sizeof(uint32_t)) {
-        res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
+    auto offset = keyOffsetMap.find(key);
+    if (offset == keyOffsetMap.end()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
+    return readTelemetry(&value, sizeof(uint64_t), offset->second);
+}
 
-    if (this->closeFunction(fd) < 0) {
-        return ZE_RESULT_ERROR_UNKNOWN;
+ze_result_t PlatformMonitoringTech::getKeyOffsets(const std::vector<std::string> &keys, std::vector<uint64_t> &offsets) const {
+    offsets.clear();
+    offsets.reserve(keys.size());
+    for (const auto &key : keys) {
+        auto offset = keyOffsetMap.find(key);
+        if (offset == keyOffsetMap.end()) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        offsets.push_back(offset->second);
     }
+    return ZE_RESULT_SUCCESS;
+}
 
-    return res;
+ze_result_t PlatformMonitoringTech::readTelemetryWindow(const std::vector<uint64_t> &offsets, size_t valueSize, std::vector<uint8_t> &window, uint64_t &windowStart) {
+    if (offsets.empty()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto bounds = std::minmax_element(offsets.begin(), offsets.end());
+    windowStart = *bounds.first;
+    window.resize(static_cast<size_t>(*bounds.second - windowStart) + valueSize);
+    return readTelemetry(window.data(), window.size(), windowStart);
 }
 
-ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
-    auto offset = keyOffsetMap.find(key);
-    if (offset == keyOffsetMap.end()) {
-        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+template <typename T>
+static void decodeTelemetryWindow(const std::vector<uint8_t> &window, uint64_t windowStart, const std::vector<uint64_t> &offsets, std::vector<T> &values) {
+    values.resize(offsets.size());
+    for (size_t i = 0; i < offsets.size(); i++) {
+        memcpy(&values[i], window.data() + (offsets[i] - windowStart), sizeof(T));
     }
-    int fd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
-    if (fd == -1) {
-        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+}
+
+ze_result_t PlatformMonitoringTech::readValues(const std::vector<uint64_t> &offsets, std::vector<uint32_t> &values) {
+    std::vector<uint8_t> window;
+    uint64_t windowStart = 0;
+    auto result = readTelemetryWindow(offsets, sizeof(uint32_t), window, windowStart);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
     }
+    decodeTelemetryWindow(window, windowStart, offsets, values);
+    return ZE_RESULT_SUCCESS;
+}
 
-    ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint64_t), baseOffset + offset->second) != sizeof(uint64_t)) {
-        res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+ze_result_t PlatformMonitoringTech::readValues(const std::vector<uint64_t> &offsets, std::vector<uint64_t> &values) {
+    std::vector<uint8_t> window;
+    uint64_t windowStart = 0;
+    auto result = readTelemetryWindow(offsets, sizeof(uint64_t), window, windowStart);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
     }
+    decodeTelemetryWindow(window, windowStart, offsets, values);
+    return ZE_RESULT_SUCCESS;
+}
 
-    if (this->closeFunction(fd) < 0) {
-        return ZE_RESULT_ERROR_UNKNOWN;
+ze_result_t PlatformMonitoringTech::readValues(const std::vector<std::string> &keys, std::vector<uint32_t> &values) {
+    std::vector<uint64_t> offsets;
+    auto result = getKeyOffsets(keys, offsets);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
     }
+    return readValues(offsets, values);
+}
 
-    return res;
+ze_result_t PlatformMonitoringTech::readValues(const std::vector<std::string> &keys, std::vector<uint64_t> &values) {
+    std::vector<uint64_t> offsets;
+    auto result = getKeyOffsets(keys, offsets);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+    return readValues(offsets, values);
 }
 
 bool compareTelemNodes(std::string &telemNode1, std::string &telemNode2) {
@@ -208,6 +277,7 @@ void PlatformMonitoringTech::create(LinuxSysmanImp *pLinuxSysmanImp, std::string
 }
 
 PlatformMonitoringTech::~PlatformMonitoringTech() {
+    closeTelemetryFd();
 }
 
 } // namespace Sysman
@@ -15,8 +15,10 @@
 
 #include <fcntl.h>
 #include <map>
+#include <mutex>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <vector>
 
 namespace L0 {
 namespace Sysman {
@@ -30,6 +32,13 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
 
     virtual ze_result_t readValue(const std::string key, uint32_t &value);
     virtual ze_result_t readValue(const std::string key, uint64_t &value);
+    // Offsets resolved once can be reused for every sample, readValues then fetches
+    // the telemetry window spanning all of them with a single pread.
+    ze_result_t getKeyOffsets(const std::vector<std::string> &keys, std::vector<uint64_t> &offsets) const;
+    virtual ze_result_t readValues(const std::vector<uint64_t> &offsets, std::vector<uint32_t> &values);
+    virtual ze_result_t readValues(const std::vector<uint64_t> &offsets, std::vector<uint64_t> &values);
+    virtual ze_result_t readValues(const std::vector<std::string> &keys, std::vector<uint32_t> &values);
+    virtual ze_result_t readValues(const std::vector<std::string> &keys, std::vector<uint64_t> &values);
     static ze_result_t enumerateRootTelemIndex(FsAccess *pFsAccess, std::string &gpuUpstreamPortPath);
     static void create(LinuxSysmanImp *pLinuxSysmanImp, std::string &gpuUpstreamPortPath,
                        std::map<uint32_t, L0::Sysman::PlatformMonitoringTech *> &mapOfSubDeviceIdToPmtObject);
@@ -42,6 +51,11 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
     ze_result_t init(FsAccess *pFsAccess, const std::string &gpuUpstreamPortPath, PRODUCT_FAMILY productFamily);
     static void doInitPmtObject(FsAccess *pFsAccess, uint32_t subdeviceId, PlatformMonitoringTech *pPmt, const std::string &gpuUpstreamPortPath,
                                 std::map<uint32_t, L0::Sysman::PlatformMonitoringTech *> &mapOfSubDeviceIdToPmtObject, PRODUCT_FAMILY productFamily);
+    ze_result_t readTelemetry(void *buffer, size_t size, uint64_t offset);
+    ze_result_t readTelemetryWindow(const std::vector<uint64_t> &offsets, size_t valueSize, std::vector<uint8_t> &window, uint64_t &windowStart);
+    void closeTelemetryFd();
+    int telemetryFd = -1;
+    std::mutex telemetryFdMutex;
     decltype(&NEO::SysCalls::open) openFunction = NEO::SysCalls::open;
     decltype(&NEO::SysCalls::close) closeFunction = NEO::SysCalls::close;
     decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
@@ -7,6 +7,8 @@
 
 #include "level_zero/sysman/source/linux/sysman_fs_access.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
 #include <climits>
 
 #include <array>
@@ -400,6 +402,7 @@ SysfsAccess::SysfsAccess(const std::string dev) {
             break;
         }
     }
+    writeCacheEnabled = NEO::DebugManager.flags.EnableSysmanSysfsWriteCache.get() == 1;
 }
 
 SysfsAccess *SysfsAccess::create(const std::string dev) {
@@ -504,8 +507,7 @@ ze_result_t SysfsAccess::read(const std::string file, std::vector<std::string> &
 }
 
 ze_result_t SysfsAccess::write(const std::string file, const std::string val) {
-    // Prepend sysfs directory path and call the base write
-    return FsAccess::write(fullPath(file).c_str(), val);
+    return writeCached(file, val);
 }
 
 ze_result_t SysfsAccess::write(const std::string file, const int val) {
@@ -515,7 +517,7 @@ ze_result_t SysfsAccess::write(const std::string file, const int val) {
     if (stream.fail()) {
         return ZE_RESULT_ERROR_UNKNOWN;
     }
-    return FsAccess::write(fullPath(file), stream.str());
+    return writeCached(file, stream.str());
 }
 
 ze_result_t SysfsAccess::write(const std::string file, const double val) {
@@ -525,7 +527,7 @@ ze_result_t SysfsAccess::write(const std::string file, const double val) {
     if (stream.fail()) {
         return ZE_RESULT_ERROR_UNKNOWN;
     }
-    return FsAccess::write(fullPath(file), stream.str());
+    return writeCached(file, stream.str());
 }
 
 ze_result_t SysfsAccess::write(const std::string file, const uint64_t val) {
@@ -535,7 +537,45 @@ ze_result_t SysfsAccess::write(const std::string file, const uint64_t val) {
     if (stream.fail()) {
         return ZE_RESULT_ERROR_UNKNOWN;
     }
-    return FsAccess::write(fullPath(file), stream.str());
+    return writeCached(file, stream.str());
+}
+
+ze_result_t SysfsAccess::writeCached(const std::string &file, const std::string &val) {
+    uint64_t writeId = 0;
+    {
+        std::lock_guard<std::mutex> lock(writeCacheMutex);
+        if (writeCacheEnabled) {
+            auto it = writeCache.find(file);
+            if (it != writeCache.end() && it->second == val) {
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+        // value is unknown until the write completes
+        writeCache.erase(file);
+        writeId = ++lastWriteId;
+        pendingWrites[file] = writeId;
+    }
+
+    // Prepend sysfs directory path and call the base write
+    auto result = FsAccess::write(fullPath(file), val);
+
+    std::lock_guard<std::mutex> lock(writeCacheMutex);
+    // a later write to the same attribute or an invalidation makes this value stale
+    auto pendingWrite = pendingWrites.find(file);
+    if (pendingWrite == pendingWrites.end() || pendingWrite->second != writeId) {
+        return result;
+    }
+    pendingWrites.erase(pendingWrite);
+    if (ZE_RESULT_SUCCESS == result && writeCacheEnabled) {
+        writeCache[file] = val;
+    }
+    return result;
+}
+
+void SysfsAccess::invalidateWriteCache() {
+    std::lock_guard<std::mutex> lock(writeCacheMutex);
+    writeCache.clear();
+    pendingWrites.clear();
 }
 
 ze_result_t SysfsAccess::scanDirEntries(const std::string path, std::vector<std::string> &list) {
@@ -15,6 +15,8 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -105,6 +107,8 @@ class SysfsAccess : protected FsAccess {
     MOCKABLE_VIRTUAL ze_result_t write(const std::string file, const double val);
     ze_result_t write(const std::string file, std::vector<std::string> val);
 
+    void invalidateWriteCache();
+
     MOCKABLE_VIRTUAL ze_result_t scanDirEntries(const std::string path, std::vector<std::string> &list);
     ze_result_t readSymLink(const std::string path, std::string &buf) override;
     ze_result_t getRealPath(const std::string path, std::string &buf) override;
@@ -116,13 +120,23 @@ class SysfsAccess : protected FsAccess {
     bool isRootUser() override;
 
   protected:
+    ze_result_t writeCached(const std::string &file, const std::string &val);
+
     std::vector<std::string> deviceNames;
+    std::string dirname;
+
+    // last value successfully written to each attribute, used to skip rewriting unchanged values
+    bool writeCacheEnabled = false;
+    std::map<std::string, std::string> writeCache;
+    std::map<std::string, uint64_t> pendingWrites;
+    uint64_t lastWriteId = 0;
+    // guards the cache only, sysfs writes are issued without holding it
+    std::mutex writeCacheMutex;
 
   private:
     SysfsAccess(const std::string file);
 
     std::string fullPath(const std::string file);
-    std::string dirname;
     static const std::string drmPath;
     static const std::string devicesPath;
     static const std::string primaryDevName;
@@ -20,6 +20,7 @@
 #include "level_zero/sysman/source/linux/pmt/sysman_pmt.h"
 #include "level_zero/sysman/source/linux/pmu/sysman_pmu.h"
 #include "level_zero/sysman/source/linux/sysman_fs_access.h"
+#include "level_zero/sysman/source/sampler/sysman_sampler.h"
 
 #include <linux/pci_regs.h>
 
@@ -291,6 +292,8 @@ ze_result_t LinuxSysmanImp::gpuProcessCleanup() {
 }
 
 void LinuxSysmanImp::releaseSysmanDeviceResources() {
+    // sampler thread reads through the handles released below, stop it before they go away
+    getSysmanDeviceImp()->pSampler.reset();
     getSysmanDeviceImp()->pEngineHandleContext->releaseEngines();
     getSysmanDeviceImp()->pRasHandleContext->releaseRasHandles();
     if (!diagnosticsReset) {
@@ -304,6 +307,10 @@ void LinuxSysmanImp::releaseSysmanDeviceResources() {
 }
 
 ze_result_t LinuxSysmanImp::reInitSysmanDeviceResources() {
+    // reset restores default attribute values, values written before it must be written again
+    pSysfsAccess->invalidateWriteCache();
+    // telemetry files opened before the reset must not be reused, PMT objects are recreated with fresh descriptors
+    releasePmtObject();
     createPmtHandles();
     if (!diagnosticsReset) {
         createFwUtilInterface();
@@ -323,6 +330,7 @@ ze_result_t LinuxSysmanImp::reInitSysmanDeviceResources() {
     if (getSysmanDeviceImp()->pFirmwareHandleContext->isFirmwareInitDone()) {
         getSysmanDeviceImp()->pFirmwareHandleContext->init();
     }
+    getSysmanDeviceImp()->createSampler();
     return ZE_RESULT_SUCCESS;
 }
 
@@ -7,10 +7,20 @@
 
 #include "level_zero/sysman/source/memory/sysman_memory_imp.h"
 
+#include "level_zero/sysman/source/sampler/sysman_sampler.h"
+
 namespace L0 {
 namespace Sysman {
 
 ze_result_t MemoryImp::memoryGetBandwidth(zes_mem_bandwidth_t *pBandwidth) {
+    SysmanSampleEntry entry = {};
+    if (pSampler != nullptr && pSampler->getLatestEntry(SysmanSampledCounter::memoryBandwidth, samplerHandleIndex, entry)) {
+        pBandwidth->readCounter = entry.values[0];
+        pBandwidth->writeCounter = entry.values[1];
+        pBandwidth->maxBandwidth = entry.values[2];
+        pBandwidth->timestamp = entry.timestamp;
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsMemory->getBandwidth(pBandwidth);
 }
 
@@ -14,6 +14,7 @@
 
 namespace L0 {
 namespace Sysman {
+class SysmanSampler;
 
 class MemoryImp : public Memory, NEO::NonCopyableOrMovableClass {
   public:
@@ -28,6 +29,8 @@ class MemoryImp : public Memory, NEO::NonCopyableOrMovableClass {
     MemoryImp() = default;
     void init();
     std::unique_ptr<OsMemory> pOsMemory;
+    SysmanSampler *pSampler = nullptr;
+    uint32_t samplerHandleIndex = 0;
 
   private:
     zes_mem_properties_t memoryProperties = {};
@@ -63,12 +63,16 @@ ze_result_t LinuxPowerImp::getPropertiesExt(zes_power_ext_properties_t *pExtPope
 }
 
 ze_result_t LinuxPowerImp::getPmtEnergyCounter(zes_power_energy_counter_t *pEnergy) {
-    const std::string key("PACKAGE_ENERGY");
-    uint64_t energy = 0;
+    static const std::vector<std::string> keys = {"PACKAGE_ENERGY"};
+    std::vector<uint64_t> energy;
     constexpr uint64_t fixedPointToJoule = 1048576;
-    ze_result_t result = pPmt->readValue(key, energy);
+    ze_result_t result = pPmt->readValues(keys, energy);
+    if (result != ZE_RESULT_SUCCESS) {
+        pEnergy->energy = 0;
+        return result;
+    }
     // PMT will return energy counter in Q20 format(fixed point representation) where first 20 bits(from LSB) represent decimal part and remaining integral part which is converted into joule by division with 1048576(2^20) and then converted into microjoules
-    pEnergy->energy = (energy / fixedPointToJoule) * convertJouleToMicroJoule;
+    pEnergy->energy = (energy[0] / fixedPointToJoule) * convertJouleToMicroJoule;
     return result;
 }
 ze_result_t LinuxPowerImp::getEnergyCounter(zes_power_energy_counter_t *pEnergy) {
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 
 #include "level_zero/sysman/source/power/sysman_os_power.h"
+#include "level_zero/sysman/source/sampler/sysman_sampler.h"
 #include "level_zero/sysman/source/sysman_device_imp.h"
 
 namespace L0 {
@@ -34,6 +35,12 @@ ze_result_t PowerImp::powerGetProperties(zes_power_properties_t *pProperties) {
 }
 
 ze_result_t PowerImp::powerGetEnergyCounter(zes_power_energy_counter_t *pEnergy) {
+    SysmanSampleEntry entry = {};
+    if (pSampler != nullptr && pSampler->getLatestEntry(SysmanSampledCounter::energy, samplerHandleIndex, entry)) {
+        pEnergy->energy = entry.values[0];
+        pEnergy->timestamp = entry.timestamp;
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsPower->getEnergyCounter(pEnergy);
 }
 
@@ -14,6 +14,7 @@
 namespace L0 {
 namespace Sysman {
 class OsPower;
+class SysmanSampler;
 class PowerImp : public Power, NEO::NonCopyableOrMovableClass {
   public:
     ze_result_t powerGetProperties(zes_power_properties_t *pProperties) override;
@@ -30,6 +31,8 @@ class PowerImp : public Power, NEO::NonCopyableOrMovableClass {
     ~PowerImp() override;
 
     OsPower *pOsPower = nullptr;
+    SysmanSampler *pSampler = nullptr;
+    uint32_t samplerHandleIndex = 0;
     void init();
 
   private:
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/sampler/sysman_shared_memory.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace L0 {
+namespace Sysman {
+
+class SysmanSharedMemoryLinux : public SysmanSharedMemory {
+  public:
+    SysmanSharedMemoryLinux(const std::string &name, void *memory, size_t size, bool owner) : name(name), owner(owner) {
+        this->memory = memory;
+        this->size = size;
+    }
+
+    ~SysmanSharedMemoryLinux() override {
+        munmap(memory, size);
+        if (owner) {
+            shm_unlink(name.c_str());
+        }
+    }
+
+  protected:
+    std::string name;
+    bool owner = false;
+};
+
+static std::string getSharedMemoryObjectName(const std::string &name) {
+    return (name.empty() || name[0] != '/') ? "/" + name : name;
+}
+
+std::unique_ptr<SysmanSharedMemory> SysmanSharedMemory::create(const std::string &name, size_t size) {
+    auto objectName = getSharedMemoryObjectName(name);
+    // exclusive create, the owner unlinks the object on destruction and must not pull it from under another owner
+    int fd = shm_open(objectName.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
+                              "Failed to create shared memory %s\n", objectName.c_str());
+        return nullptr;
+    }
+
+    void *memory = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+        memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if (memory == MAP_FAILED) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
+                              "Failed to map shared memory %s\n", objectName.c_str());
+        shm_unlink(objectName.c_str());
+        return nullptr;
+    }
+    return std::make_unique<SysmanSharedMemoryLinux>(objectName, memory, size, true);
+}
+
+std::unique_ptr<SysmanSharedMemory> SysmanSharedMemory::open(const std::string &name) {
+    auto objectName = getSharedMemoryObjectName(name);
+    int fd = shm_open(objectName.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    void *memory = MAP_FAILED;
+    struct stat objectStat = {};
+    if (fstat(fd, &objectStat) == 0 && objectStat.st_size > 0) {
+        memory = mmap(nullptr, static_cast<size_t>(objectStat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if (memory == MAP_FAILED) {
+        return nullptr;
+    }
+    return std::make_unique<SysmanSharedMemoryLinux>(objectName, memory, static_cast<size_t>(objectStat.st_size), false);
+}
+
+} // namespace Sysman
+} // namespace L0
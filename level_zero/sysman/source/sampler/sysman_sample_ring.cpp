@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/sampler/sysman_sample_ring.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+
+#include <cstring>
+#include <new>
+
+namespace L0 {
+namespace Sysman {
+
+size_t SysmanSampleRing::getRequiredSize(uint32_t capacity) {
+    return alignUp(sizeof(Header), alignof(Slot)) + static_cast<size_t>(capacity) * sizeof(Slot);
+}
+
+std::unique_ptr<SysmanSampleRing> SysmanSampleRing::create(void *memory, size_t size, uint32_t capacity) {
+    if (memory == nullptr || capacity == 0u || size < getRequiredSize(capacity) || !isAligned<alignof(Slot)>(memory)) {
+        return nullptr;
+    }
+
+    auto header = new (memory) Header;
+    header->magic = magic;
+    header->version = version;
+    header->capacity = capacity;
+    header->slotSize = static_cast<uint32_t>(sizeof(Slot));
+    header->writeCount.store(0u, std::memory_order_relaxed);
+
+    auto slots = reinterpret_cast<Slot *>(ptrOffset(memory, alignUp(sizeof(Header), alignof(Slot))));
+    for (uint32_t i = 0; i < capacity; i++) {
+        auto slot = new (&slots[i]) Slot;
+        slot->lockSequence.store(0u, std::memory_order_relaxed);
+        memset(&slot->sample, 0, sizeof(SysmanSample));
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return std::unique_ptr<SysmanSampleRing>(new SysmanSampleRing(header));
+}
+
+std::unique_ptr<SysmanSampleRing> SysmanSampleRing::attach(void *memory, size_t size) {
+    if (memory == nullptr || size < sizeof(Header) || !isAligned<alignof(Slot)>(memory)) {
+        return nullptr;
+    }
+    auto header = reinterpret_cast<Header *>(memory);
+    if (header->magic != magic || header->version != version || header->slotSize != sizeof(Slot) ||
+        header->capacity == 0u || size < getRequiredSize(header->capacity)) {
+        return nullptr;
+    }
+    return std::unique_ptr<SysmanSampleRing>(new SysmanSampleRing(header));
+}
+
+SysmanSampleRing::SysmanSampleRing(Header *header) : header(header) {
+}
+
+SysmanSampleRing::Slot *SysmanSampleRing::getSlot(uint64_t sampleIndex) const {
+    auto slots = reinterpret_cast<Slot *>(ptrOffset(header, alignUp(sizeof(Header), alignof(Slot))));
+    return &slots[sampleIndex % header->capacity];
+}
+
+void SysmanSampleRing::publish(const SysmanSample &sample) {
+    auto sampleIndex = header->writeCount.load(std::memory_order_relaxed);
+    auto slot = getSlot(sampleIndex);
+
+    // odd sequence marks the slot as being written
+    auto lockSequence = slot->lockSequence.load(std::memory_order_relaxed);
+    slot->lockSequence.store(lockSequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    memcpy(&slot->sample, &sample, sizeof(SysmanSample));
+    slot->sample.sequence = sampleIndex;
+
+    slot->lockSequence.store(lockSequence + 2, std::memory_order_release);
+    header->writeCount.store(sampleIndex + 1, std::memory_order_release);
+}
+
+bool SysmanSampleRing::readSample(uint64_t sampleIndex, SysmanSample &sample) const {
+    auto slot = getSlot(sampleIndex);
+    for (uint32_t retry = 0; retry < maxReadRetries; retry++) {
+        auto writeCount = header->writeCount.load(std::memory_order_acquire);
+        if (sampleIndex >= writeCount || writeCount - sampleIndex > header->capacity) {
+            // not written yet or already overwritten
+            return false;
+        }
+
+        auto lockSequenceBefore = slot->lockSequence.load(std::memory_order_acquire);
+        if (lockSequenceBefore & 1u) {
+            continue;
+        }
+        memcpy(&sample, &slot->sample, sizeof(SysmanSample));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto lockSequenceAfter = slot->lockSequence.load(std::memory_order_relaxed);
+
+        if (lockSequenceBefore == lockSequenceAfter) {
+            return sample.sequence == sampleIndex;
+        }
+    }
+    return false;
+}
+
+bool SysmanSampleRing::readLatest(SysmanSample &sample) const {
+    for (uint32_t retry = 0; retry < maxReadRetries; retry++) {
+        auto writeCount = header->writeCount.load(std::memory_order_acquire);
+        if (writeCount == 0u) {
+            return false;
+        }
+        if (readSample(writeCount - 1, sample)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t SysmanSampleRing::getWriteCount() const {
+    return header->writeCount.load(std::memory_order_acquire);
+}
+
+uint32_t SysmanSampleRing::getCapacity() const {
+    return header->capacity;
+}
+
+} // namespace Sysman
+} // namespace L0
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace L0 {
+namespace Sysman {
+
+enum class SysmanSampledCounter : uint32_t {
+    energy = 0,           // values[0]: energy in microjoules
+    temperature,          // values[0]: temperature in degrees Celsius, bit pattern of double
+    frequency,            // values[0..2]: actual, request, efficient frequency in MHz, bit patterns of double
+    engineActivity,       // values[0]: active time in microseconds
+    memoryBandwidth,      // values[0..2]: read counter, write counter, max bandwidth
+    count
+};
+
+struct SysmanSampleEntry {
+    SysmanSampledCounter counter;
+    uint32_t handleIndex;
+    uint64_t timestamp;
+    uint64_t values[3];
+};
+
+struct SysmanSample {
+    static constexpr uint32_t maxEntries = 128u;
+
+    uint64_t sequence;
+    uint64_t timestamp; // steady clock, in nanoseconds
+    uint32_t numEntries;
+    uint32_t reserved;
+    SysmanSampleEntry entries[maxEntries];
+};
+
+// Fixed size ring of samples laid out in caller provided memory, which may be shared between processes.
+// There is a single writer; any number of readers copy a slot out under a per slot sequence lock and retry
+// when the writer raced with them, so neither side ever blocks.
+class SysmanSampleRing : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t magic = 0x4c53535au; // "ZSSL"
+    static constexpr uint32_t version = 1u;
+
+    static size_t getRequiredSize(uint32_t capacity);
+    static std::unique_ptr<SysmanSampleRing> create(void *memory, size_t size, uint32_t capacity);
+    static std::unique_ptr<SysmanSampleRing> attach(void *memory, size_t size);
+
+    void publish(const SysmanSample &sample);
+    bool readSample(uint64_t sampleIndex, SysmanSample &sample) const;
+    bool readLatest(SysmanSample &sample) const;
+
+    uint64_t getWriteCount() const;
+    uint32_t getCapacity() const;
+
+  protected:
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t capacity;
+        uint32_t slotSize;
+        std::atomic<uint64_t> writeCount;
+    };
+
+    struct Slot {
+        std::atomic<uint64_t> lockSequence;
+        SysmanSample sample;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "ring is shared across processes and needs address free atomics");
+
+    SysmanSampleRing(Header *header);
+    Slot *getSlot(uint64_t sampleIndex) const;
+
+    static constexpr uint32_t maxReadRetries = 16u;
+
+    Header *header = nullptr;
+};
+
+} // namespace Sysman
+} // namespace L0
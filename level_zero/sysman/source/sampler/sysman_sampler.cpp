@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/sampler/sysman_sampler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+
+#include "level_zero/sysman/source/engine/sysman_engine_imp.h"
+#include "level_zero/sysman/source/frequency/sysman_frequency_imp.h"
+#include "level_zero/sysman/source/frequency/sysman_os_frequency.h"
+#include "level_zero/sysman/source/memory/sysman_memory_imp.h"
+#include "level_zero/sysman/source/power/sysman_os_power.h"
+#include "level_zero/sysman/source/power/sysman_power_imp.h"
+#include "level_zero/sysman/source/sampler/sysman_shared_memory.h"
+#include "level_zero/sysman/source/sysman_device_imp.h"
+#include "level_zero/sysman/source/temperature/sysman_temperature_imp.h"
+
+#include <chrono>
+#include <cstring>
+
+namespace L0 {
+namespace Sysman {
+
+static uint64_t doubleToBits(double value) {
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static void appendEntry(SysmanSample &sample, SysmanSampledCounter counter, uint32_t handleIndex, uint64_t timestamp,
+                        uint64_t value0, uint64_t value1 = 0u, uint64_t value2 = 0u) {
+    if (sample.numEntries >= SysmanSample::maxEntries) {
+        return;
+    }
+    auto &entry = sample.entries[sample.numEntries++];
+    entry.counter = counter;
+    entry.handleIndex = handleIndex;
+    entry.timestamp = timestamp;
+    entry.values[0] = value0;
+    entry.values[1] = value1;
+    entry.values[2] = value2;
+}
+
+template <typename ImpT, typename BaseT, typename HandleT, typename GetHandlesT>
+static void getImpHandles(GetHandlesT &&getHandles, std::vector<ImpT *> &impHandles) {
+    uint32_t count = 0;
+    if (getHandles(&count, nullptr) != ZE_RESULT_SUCCESS || count == 0) {
+        return;
+    }
+    std::vector<HandleT> handles(count, nullptr);
+    if (getHandles(&count, handles.data()) != ZE_RESULT_SUCCESS) {
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        impHandles.push_back(static_cast<ImpT *>(BaseT::fromHandle(handles[i])));
+    }
+}
+
+std::unique_ptr<SysmanSampler> SysmanSampler::create(SysmanDeviceImp *pSysmanDevice) {
+    if (NEO::DebugManager.flags.EnableSysmanSampler.get() != 1) {
+        return nullptr;
+    }
+
+    uint32_t periodMs = defaultPeriodMs;
+    if (NEO::DebugManager.flags.SysmanSamplerPeriodMs.get() > 0) {
+        periodMs = static_cast<uint32_t>(NEO::DebugManager.flags.SysmanSamplerPeriodMs.get());
+    }
+    uint32_t counterMask = allCounters;
+    if (NEO::DebugManager.flags.SysmanSamplerCounterMask.get() != -1) {
+        counterMask = static_cast<uint32_t>(NEO::DebugManager.flags.SysmanSamplerCounterMask.get()) & allCounters;
+    }
+    uint32_t ringCapacity = defaultRingCapacity;
+    if (NEO::DebugManager.flags.SysmanSamplerRingCapacity.get() > 0) {
+        ringCapacity = static_cast<uint32_t>(NEO::DebugManager.flags.SysmanSamplerRingCapacity.get());
+    }
+    bool serveQueries = NEO::DebugManager.flags.SysmanSamplerServeQueries.get() == 1;
+
+    std::string sharedMemoryName;
+    if (NEO::DebugManager.flags.SysmanSamplerSharedMemoryName.get() != "unk") {
+        sharedMemoryName = NEO::DebugManager.flags.SysmanSamplerSharedMemoryName.get() + "_" + std::to_string(pSysmanDevice->getRootDeviceIndex());
+    }
+
+    auto sampler = std::make_unique<SysmanSampler>(pSysmanDevice, periodMs, counterMask, ringCapacity, serveQueries);
+    if (!sampler->initRing(sharedMemoryName)) {
+        return nullptr;
+    }
+    sampler->registerHandles();
+    return sampler;
+}
+
+SysmanSampler::SysmanSampler(SysmanDeviceImp *pSysmanDevice, uint32_t periodMs, uint32_t counterMask, uint32_t ringCapacity, bool serveQueries)
+    : pSysmanDevice(pSysmanDevice), periodMs(periodMs), counterMask(counterMask), ringCapacity(ringCapacity), serveQueries(serveQueries),
+      pendingSample(std::make_unique<SysmanSample>()) {
+}
+
+SysmanSampler::~SysmanSampler() {
+    stop();
+
+    for (auto pPower : powerHandles) {
+        pPower->pSampler = nullptr;
+    }
+    for (auto pTemperature : temperatureHandles) {
+        pTemperature->pSampler = nullptr;
+    }
+    for (auto pEngine : engineHandles) {
+        pEngine->pSampler = nullptr;
+    }
+    for (auto pMemory : memoryHandles) {
+        pMemory->pSampler = nullptr;
+    }
+}
+
+bool SysmanSampler::initRing(const std::string &sharedMemoryName) {
+    auto ringSize = SysmanSampleRing::getRequiredSize(ringCapacity);
+    void *ringMemory = nullptr;
+
+    if (!sharedMemoryName.empty()) {
+        sharedMemory = SysmanSharedMemory::create(sharedMemoryName, ringSize);
+        if (sharedMemory) {
+            ringMemory = sharedMemory->getMemory();
+        } else {
+            NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
+                                  "Sysman sampler falls back to process private ring, shared memory %s not available\n", sharedMemoryName.c_str());
+        }
+    }
+    if (ringMemory == nullptr) {
+        auto storageSize = alignUp(ringSize, sizeof(uint64_t)) / sizeof(uint64_t);
+        privateRingStorage = std::make_unique<uint64_t[]>(storageSize);
+        ringMemory = privateRingStorage.get();
+    }
+
+    ring = SysmanSampleRing::create(ringMemory, ringSize, ringCapacity);
+    return ring != nullptr;
+}
+
+void SysmanSampler::registerHandles() {
+    if (isCounterEnabled(SysmanSampledCounter::energy)) {
+        getImpHandles<PowerImp, Power, zes_pwr_handle_t>([this](uint32_t *pCount, zes_pwr_handle_t *phPower) { return pSysmanDevice->powerGet(pCount, phPower); },
+                                                         powerHandles);
+    }
+    if (isCounterEnabled(SysmanSampledCounter::temperature)) {
+        getImpHandles<TemperatureImp, Temperature, zes_temp_handle_t>([this](uint32_t *pCount, zes_temp_handle_t *phTemperature) { return pSysmanDevice->temperatureGet(pCount, phTemperature); },
+                                                                      temperatureHandles);
+    }
+    if (isCounterEnabled(SysmanSampledCounter::frequency)) {
+        getImpHandles<FrequencyImp, Frequency, zes_freq_handle_t>([this](uint32_t *pCount, zes_freq_handle_t *phFrequency) { return pSysmanDevice->frequencyGet(pCount, phFrequency); },
+                                                                  frequencyHandles);
+    }
+    if (isCounterEnabled(SysmanSampledCounter::engineActivity)) {
+        getImpHandles<EngineImp, Engine, zes_engine_handle_t>([this](uint32_t *pCount, zes_engine_handle_t *phEngine) { return pSysmanDevice->engineGet(pCount, phEngine); },
+                                                              engineHandles);
+    }
+    if (isCounterEnabled(SysmanSampledCounter::memoryBandwidth)) {
+        getImpHandles<MemoryImp, Memory, zes_mem_handle_t>([this](uint32_t *pCount, zes_mem_handle_t *phMemory) { return pSysmanDevice->memoryGet(pCount, phMemory); },
+                                                           memoryHandles);
+    }
+    attachToHandles();
+}
+
+void SysmanSampler::attachToHandles() {
+    if (!serveQueries) {
+        return;
+    }
+    // frequency state carries more than a sample entry holds, so frequency queries always read the device
+    for (uint32_t i = 0; i < powerHandles.size(); i++) {
+        powerHandles[i]->pSampler = this;
+        powerHandles[i]->samplerHandleIndex = i;
+    }
+    for (uint32_t i = 0; i < temperatureHandles.size(); i++) {
+        temperatureHandles[i]->pSampler = this;
+        temperatureHandles[i]->samplerHandleIndex = i;
+    }
+    for (uint32_t i = 0; i < engineHandles.size(); i++) {
+        engineHandles[i]->pSampler = this;
+        engineHandles[i]->samplerHandleIndex = i;
+    }
+    for (uint32_t i = 0; i < memoryHandles.size(); i++) {
+        memoryHandles[i]->pSampler = this;
+        memoryHandles[i]->samplerHandleIndex = i;
+    }
+}
+
+uint64_t SysmanSampler::getCurrentTimeNs() const {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void SysmanSampler::collectSample(SysmanSample &sample) {
+    // read through the os layer, handle level queries may be answered from this very ring
+    for (uint32_t i = 0; i < powerHandles.size(); i++) {
+        zes_power_energy_counter_t energy = {};
+        if (powerHandles[i]->pOsPower->getEnergyCounter(&energy) == ZE_RESULT_SUCCESS) {
+            appendEntry(sample, SysmanSampledCounter::energy, i, energy.timestamp, energy.energy);
+        }
+    }
+    for (uint32_t i = 0; i < temperatureHandles.size(); i++) {
+        double temperature = 0.0;
+        if (temperatureHandles[i]->pOsTemperature->getSensorTemperature(&temperature) == ZE_RESULT_SUCCESS) {
+            appendEntry(sample, SysmanSampledCounter::temperature, i, sample.timestamp, doubleToBits(temperature));
+        }
+    }
+    for (uint32_t i = 0; i < frequencyHandles.size(); i++) {
+        zes_freq_state_t state = {};
+        state.stype = ZES_STRUCTURE_TYPE_FREQ_STATE;
+        if (frequencyHandles[i]->pOsFrequency->osFrequencyGetState(&state) == ZE_RESULT_SUCCESS) {
+            appendEntry(sample, SysmanSampledCounter::frequency, i, sample.timestamp, doubleToBits(state.actual), doubleToBits(state.request), doubleToBits(state.efficient));
+        }
+    }
+    for (uint32_t i = 0; i < engineHandles.size(); i++) {
+        zes_engine_stats_t stats = {};
+        if (engineHandles[i]->pOsEngine->getActivity(&stats) == ZE_RESULT_SUCCESS) {
+            appendEntry(sample, SysmanSampledCounter::engineActivity, i, stats.timestamp, stats.activeTime);
+        }
+    }
+    for (uint32_t i = 0; i < memoryHandles.size(); i++) {
+        zes_mem_bandwidth_t bandwidth = {};
+        if (memoryHandles[i]->pOsMemory->getBandwidth(&bandwidth) == ZE_RESULT_SUCCESS) {
+            appendEntry(sample, SysmanSampledCounter::memoryBandwidth, i, bandwidth.timestamp, bandwidth.readCounter, bandwidth.writeCounter, bandwidth.maxBandwidth);
+        }
+    }
+}
+
+void SysmanSampler::sampleOnce() {
+    auto &sample = *pendingSample;
+    sample.timestamp = getCurrentTimeNs();
+    sample.numEntries = 0u;
+    collectSample(sample);
+    ring->publish(sample);
+}
+
+bool SysmanSampler::getLatestEntry(SysmanSampledCounter counter, uint32_t handleIndex, SysmanSampleEntry &entry) const {
+    SysmanSample sample;
+    if (!ring->readLatest(sample)) {
+        return false;
+    }
+
+    // a stalled sampler must not hide changes, fall back to reading the device
+    auto maxSampleAgeNs = 2ull * periodMs * 1000000ull;
+    if (getCurrentTimeNs() - sample.timestamp > maxSampleAgeNs) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < sample.numEntries; i++) {
+        if (sample.entries[i].counter == counter && sample.entries[i].handleIndex == handleIndex) {
+            entry = sample.entries[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+void SysmanSampler::samplerLoop() {
+    auto period = std::chrono::milliseconds(periodMs);
+    auto nextSampleTime = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(samplerMutex);
+    while (!stopRequested) {
+        lock.unlock();
+        sampleOnce();
+        lock.lock();
+
+        nextSampleTime += period;
+        auto now = std::chrono::steady_clock::now();
+        if (nextSampleTime < now) {
+            // collection took longer than the period, skip missed ticks instead of bursting
+            nextSampleTime = now + period;
+        }
+        samplerCondition.wait_until(lock, nextSampleTime, [this] { return stopRequested; });
+    }
+}
+
+void SysmanSampler::start() {
+    std::lock_guard<std::mutex> lock(samplerMutex);
+    if (samplerThread.joinable()) {
+        return;
+    }
+    stopRequested = false;
+    samplerThread = std::thread(&SysmanSampler::samplerLoop, this);
+}
+
+void SysmanSampler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(samplerMutex);
+        stopRequested = true;
+    }
+    samplerCondition.notify_all();
+    if (samplerThread.joinable()) {
+        samplerThread.join();
+    }
+}
+
+} // namespace Sysman
+} // namespace L0
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include "level_zero/sysman/source/sampler/sysman_sample_ring.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace L0 {
+namespace Sysman {
+struct SysmanDeviceImp;
+class SysmanSharedMemory;
+class PowerImp;
+class TemperatureImp;
+class FrequencyImp;
+class EngineImp;
+class MemoryImp;
+
+// Optional background thread collecting a configured set of counters at a fixed rate into a SysmanSampleRing.
+// The ring is published in named shared memory so several collectors on a node can read the same samples,
+// and zes queries of the sampled handles may be answered from the latest sample instead of doing own I/O.
+class SysmanSampler : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t defaultPeriodMs = 100u;
+    static constexpr uint32_t defaultRingCapacity = 64u;
+    static constexpr uint32_t allCounters = (1u << static_cast<uint32_t>(SysmanSampledCounter::count)) - 1;
+
+    static std::unique_ptr<SysmanSampler> create(SysmanDeviceImp *pSysmanDevice);
+
+    SysmanSampler(SysmanDeviceImp *pSysmanDevice, uint32_t periodMs, uint32_t counterMask, uint32_t ringCapacity, bool serveQueries);
+    MOCKABLE_VIRTUAL ~SysmanSampler();
+
+    bool initRing(const std::string &sharedMemoryName);
+    void registerHandles();
+    void start();
+    void stop();
+
+    void sampleOnce();
+    bool getLatestEntry(SysmanSampledCounter counter, uint32_t handleIndex, SysmanSampleEntry &entry) const;
+
+    const SysmanSampleRing *getRing() const { return ring.get(); }
+    uint32_t getPeriodMs() const { return periodMs; }
+
+  protected:
+    bool isCounterEnabled(SysmanSampledCounter counter) const {
+        return (counterMask & (1u << static_cast<uint32_t>(counter))) != 0;
+    }
+    MOCKABLE_VIRTUAL void collectSample(SysmanSample &sample);
+    void attachToHandles();
+    void samplerLoop();
+    MOCKABLE_VIRTUAL uint64_t getCurrentTimeNs() const;
+
+    SysmanDeviceImp *pSysmanDevice = nullptr;
+    const uint32_t periodMs;
+    const uint32_t counterMask;
+    const uint32_t ringCapacity;
+    const bool serveQueries;
+
+    std::vector<PowerImp *> powerHandles;
+    std::vector<TemperatureImp *> temperatureHandles;
+    std::vector<FrequencyImp *> frequencyHandles;
+    std::vector<EngineImp *> engineHandles;
+    std::vector<MemoryImp *> memoryHandles;
+
+    std::unique_ptr<SysmanSharedMemory> sharedMemory;
+    std::unique_ptr<uint64_t[]> privateRingStorage;
+    std::unique_ptr<SysmanSampleRing> ring;
+    std::unique_ptr<SysmanSample> pendingSample;
+
+    std::thread samplerThread;
+    std::mutex samplerMutex;
+    std::condition_variable samplerCondition;
+    bool stopRequested = false;
+};
+
+} // namespace Sysman
+} // namespace L0
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace L0 {
+namespace Sysman {
+
+// Named memory region visible to other processes, used to publish the sample ring
+class SysmanSharedMemory : NEO::NonCopyableOrMovableClass {
+  public:
+    // creates (or recreates) the region with given size, mapped for writing
+    static std::unique_ptr<SysmanSharedMemory> create(const std::string &name, size_t size);
+    // maps an existing region for reading
+    static std::unique_ptr<SysmanSharedMemory> open(const std::string &name);
+    virtual ~SysmanSharedMemory() = default;
+
+    void *getMemory() const { return memory; }
+    size_t getSize() const { return size; }
+
+  protected:
+    void *memory = nullptr;
+    size_t size = 0u;
+};
+
+} // namespace Sysman
+} // namespace L0
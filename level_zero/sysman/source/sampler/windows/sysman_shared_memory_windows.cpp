@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/sampler/sysman_shared_memory.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+namespace L0 {
+namespace Sysman {
+
+class SysmanSharedMemoryWindows : public SysmanSharedMemory {
+  public:
+    SysmanSharedMemoryWindows(HANDLE mapping, void *memory, size_t size) : mapping(mapping) {
+        this->memory = memory;
+        this->size = size;
+    }
+
+    ~SysmanSharedMemoryWindows() override {
+        UnmapViewOfFile(memory);
+        CloseHandle(mapping);
+    }
+
+  protected:
+    HANDLE mapping = nullptr;
+};
+
+std::unique_ptr<SysmanSharedMemory> SysmanSharedMemory::create(const std::string &name, size_t size) {
+    auto sizeHigh = static_cast<DWORD>(static_cast<uint64_t>(size) >> 32);
+    auto sizeLow = static_cast<DWORD>(static_cast<uint64_t>(size) & 0xffffffffu);
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, sizeHigh, sizeLow, name.c_str());
+    // mapping owned by another process would get two writers, only a newly created one is used
+    if (mapping == nullptr || GetLastError() == ERROR_ALREADY_EXISTS) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
+                              "Failed to create shared memory %s\n", name.c_str());
+        if (mapping != nullptr) {
+            CloseHandle(mapping);
+        }
+        return nullptr;
+    }
+
+    void *memory = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (memory == nullptr) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
+                              "Failed to map shared memory %s\n", name.c_str());
+        CloseHandle(mapping);
+        return nullptr;
+    }
+    return std::make_unique<SysmanSharedMemoryWindows>(mapping, memory, size);
+}
+
+std::unique_ptr<SysmanSharedMemory> SysmanSharedMemory::open(const std::string &name) {
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+    if (mapping == nullptr) {
+        return nullptr;
+    }
+
+    void *memory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    MEMORY_BASIC_INFORMATION memoryInfo = {};
+    if (memory == nullptr || VirtualQuery(memory, &memoryInfo, sizeof(memoryInfo)) == 0) {
+        if (memory != nullptr) {
+            UnmapViewOfFile(memory);
+        }
+        CloseHandle(mapping);
+        return nullptr;
+    }
+    return std::make_unique<SysmanSharedMemoryWindows>(mapping, memory, static_cast<size_t>(memoryInfo.RegionSize));
+}
+
+} // namespace Sysman
+} // namespace L0
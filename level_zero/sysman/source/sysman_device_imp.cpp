@@ -13,6 +13,7 @@
 #include "level_zero/sysman/source/global_operations/sysman_global_operations_imp.h"
 #include "level_zero/sysman/source/os_sysman.h"
 #include "level_zero/sysman/source/pci/sysman_pci_imp.h"
+#include "level_zero/sysman/source/sampler/sysman_sampler.h"
 
 #include <vector>
 
@@ -42,6 +43,7 @@ SysmanDeviceImp::SysmanDeviceImp(NEO::ExecutionEnvironment *executionEnvironment
 }
 
 SysmanDeviceImp::~SysmanDeviceImp() {
+    pSampler.reset();
     freeResource(pGlobalOperations);
     freeResource(pDiagnosticsHandleContext);
     freeResource(pRasHandleContext);
@@ -66,9 +68,17 @@ ze_result_t SysmanDeviceImp::init() {
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
+    createSampler();
     return result;
 }
 
+void SysmanDeviceImp::createSampler() {
+    pSampler = SysmanSampler::create(this);
+    if (pSampler) {
+        pSampler->start();
+    }
+}
+
 ze_result_t SysmanDeviceImp::deviceGetProperties(zes_device_properties_t *pProperties) {
     return pGlobalOperations->deviceGetProperties(pProperties);
 }
@@ -13,11 +13,13 @@
 
 #include "level_zero/sysman/source/sysman_device.h"
 
+#include <memory>
 #include <unordered_map>
 
 namespace L0 {
 namespace Sysman {
 struct OsSysman;
+class SysmanSampler;
 
 struct SysmanDeviceImp : SysmanDevice, NEO::NonCopyableOrMovableClass {
 
@@ -26,6 +28,7 @@ struct SysmanDeviceImp : SysmanDevice, NEO::NonCopyableOrMovableClass {
 
     SysmanDeviceImp() = delete;
     ze_result_t init();
+    void createSampler();
 
     OsSysman *pOsSysman = nullptr;
 
@@ -52,6 +55,7 @@ struct SysmanDeviceImp : SysmanDevice, NEO::NonCopyableOrMovableClass {
     Ecc *pEcc = nullptr;
     TemperatureHandleContext *pTempHandleContext = nullptr;
     Pci *pPci = nullptr;
+    std::unique_ptr<SysmanSampler> pSampler;
 
     ze_result_t powerGet(uint32_t *pCount, zes_pwr_handle_t *phPower) override;
     ze_result_t powerGetCardDomain(zes_pwr_handle_t *phPower) override;
@@ -58,25 +58,17 @@ ze_result_t LinuxTemperatureImp::getGlobalMaxTemperatureNoSubDevice(double *pTem
     uint32_t maxCoreTemperature = 0;
     std::string key;
     if (productFamily == IGFX_DG1) {
-        uint32_t computeTemperature = 0;
-        key = "COMPUTE_TEMPERATURES";
-        result = pPmt->readValue(key, computeTemperature);
+        static const std::vector<std::string> keys = {"COMPUTE_TEMPERATURES", "CORE_TEMPERATURES"};
+        std::vector<uint32_t> temperatures;
+        result = pPmt->readValues(keys, temperatures);
         if (result != ZE_RESULT_SUCCESS) {
-            NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Pmt->readvalue() for COMPUTE_TEMPERATURES is returning error:0x%x \n", __FUNCTION__, result);
+            NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Pmt->readValues() for COMPUTE_TEMPERATURES and CORE_TEMPERATURES is returning error:0x%x \n", __FUNCTION__, result);
             return result;
         }
         // Check max temperature among IA, GT and LLC sensors across COMPUTE_TEMPERATURES
-        maxComputeTemperature = getMaxTemperature(computeTemperature, numComputeTemperatureEntries);
-
-        uint32_t coreTemperature = 0;
-        key = "CORE_TEMPERATURES";
-        result = pPmt->readValue(key, coreTemperature);
-        if (result != ZE_RESULT_SUCCESS) {
-            NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Pmt->readvalue() for CORE_TEMPERATURES is returning error:0x%x \n", __FUNCTION__, result);
-            return result;
-        }
+        maxComputeTemperature = getMaxTemperature(temperatures[0], numComputeTemperatureEntries);
         // Check max temperature among CORE0, CORE1, CORE2, CORE3 sensors across CORE_TEMPERATURES
-        maxCoreTemperature = getMaxTemperature(coreTemperature, numCoreTemperatureEntries);
+        maxCoreTemperature = getMaxTemperature(temperatures[1], numCoreTemperatureEntries);
     }
 
     // SOC_TEMPERATURES is present in all product families
@@ -169,17 +161,16 @@ ze_result_t LinuxTemperatureImp::getMemoryMaxTemperature(double *pTemperature) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    std::vector<uint32_t> maxDeviceTemperatureList;
+    std::vector<std::string> keys;
     for (auto hbmModuleIndex = 0u; hbmModuleIndex < numHbmModules; hbmModuleIndex++) {
-        uint32_t maxDeviceTemperature = 0;
         // To read HBM 0's max device temperature key would be HBM0MaxDeviceTemperature
-        std::string key = "HBM" + std::to_string(hbmModuleIndex) + "MaxDeviceTemperature";
-        result = pPmt->readValue(key, maxDeviceTemperature);
-        if (result != ZE_RESULT_SUCCESS) {
-            NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Pmt->readvalue() for %s is returning error:0x%x \n", __FUNCTION__, key.c_str(), result);
-            return result;
-        }
-        maxDeviceTemperatureList.push_back(maxDeviceTemperature);
+        keys.push_back("HBM" + std::to_string(hbmModuleIndex) + "MaxDeviceTemperature");
+    }
+    std::vector<uint32_t> maxDeviceTemperatureList;
+    result = pPmt->readValues(keys, maxDeviceTemperatureList);
+    if (result != ZE_RESULT_SUCCESS) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Pmt->readValues() for HBM max device temperatures is returning error:0x%x \n", __FUNCTION__, result);
+        return result;
     }
 
     *pTemperature = static_cast<double>(*std::max_element(maxDeviceTemperatureList.begin(), maxDeviceTemperatureList.end()));
@@ -7,8 +7,11 @@
 
 #include "level_zero/sysman/source/temperature/sysman_temperature_imp.h"
 
+#include "level_zero/sysman/source/sampler/sysman_sampler.h"
 #include "level_zero/sysman/source/sysman_device_imp.h"
 
+#include <cstring>
+
 namespace L0 {
 namespace Sysman {
 
@@ -26,6 +29,11 @@ ze_result_t TemperatureImp::temperatureSetConfig(const zes_temp_config_t *pConfi
 }
 
 ze_result_t TemperatureImp::temperatureGetState(double *pTemperature) {
+    SysmanSampleEntry entry = {};
+    if (pSampler != nullptr && pSampler->getLatestEntry(SysmanSampledCounter::temperature, samplerHandleIndex, entry)) {
+        memcpy(pTemperature, &entry.values[0], sizeof(double));
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsTemperature->getSensorTemperature(pTemperature);
 }
 
@@ -14,6 +14,7 @@
 
 namespace L0 {
 namespace Sysman {
+class SysmanSampler;
 class TemperatureImp : public Temperature, NEO::NonCopyableOrMovableClass {
   public:
     ze_result_t temperatureGetProperties(zes_temp_properties_t *pProperties) override;
@@ -26,6 +27,8 @@ class TemperatureImp : public Temperature, NEO::NonCopyableOrMovableClass {
     ~TemperatureImp() override;
 
     std::unique_ptr<OsTemperature> pOsTemperature = nullptr;
+    SysmanSampler *pSampler = nullptr;
+    uint32_t samplerHandleIndex = 0;
     void init();
 };
 } // namespace Sysman
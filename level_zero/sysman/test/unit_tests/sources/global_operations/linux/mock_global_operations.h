@@ -87,6 +87,7 @@ struct MockGlobalOperationsFirmwareHandleContext : public L0::Sysman::FirmwareHa
 };
 
 struct MockGlobalOperationsSysfsAccess : public L0::Sysman::SysfsAccess {
+    using L0::Sysman::SysfsAccess::writeCache;
 
     ze_result_t mockScanDirEntriesError = ZE_RESULT_SUCCESS;
     ze_result_t mockReadError = ZE_RESULT_SUCCESS;
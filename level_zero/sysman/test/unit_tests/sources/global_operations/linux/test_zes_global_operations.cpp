@@ -9,6 +9,7 @@
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
 
+#include "level_zero/sysman/source/sampler/sysman_sampler.h"
 #include "level_zero/sysman/test/unit_tests/sources/global_operations/linux/mock_global_operations.h"
 #include "level_zero/sysman/test/unit_tests/sources/linux/mock_sysman_fixture.h"
 
@@ -734,6 +735,43 @@ TEST_F(SysmanGlobalOperationsFixture, GivenForceTrueWhenCallingResetThenSuccessI
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(SysmanGlobalOperationsFixture, GivenSamplerRunningWhenDeviceResourcesAreReleasedAndReinitializedThenSamplerIsStoppedAndRecreated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSysmanSampler.set(1);
+    DebugManager.flags.SysmanSamplerCounterMask.set(0);
+    DebugManager.flags.SysmanSamplerPeriodMs.set(1000);
+
+    device->createSampler();
+    ASSERT_NE(nullptr, device->pSampler);
+
+    pLinuxSysmanImp->releaseSysmanDeviceResources();
+    EXPECT_EQ(nullptr, device->pSampler);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pLinuxSysmanImp->reInitSysmanDeviceResources());
+    EXPECT_NE(nullptr, device->pSampler);
+}
+
+TEST_F(SysmanGlobalOperationsFixture, GivenCachedSysfsWritesWhenCallingResetThenWriteCacheIsInvalidated) {
+    pSysfsAccess->writeCache["gt_min_freq_mhz"] = "300";
+    pSysfsAccess->writeCache["power1_max"] = "150000000";
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceReset(device, true));
+    EXPECT_TRUE(pSysfsAccess->writeCache.empty());
+}
+
+TEST_F(SysmanGlobalOperationsFixture, GivenSamplerRunningWhenCallingResetThenSamplerIsRecreated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSysmanSampler.set(1);
+    DebugManager.flags.SysmanSamplerCounterMask.set(0);
+    DebugManager.flags.SysmanSamplerPeriodMs.set(1000);
+
+    device->createSampler();
+    ASSERT_NE(nullptr, device->pSampler);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceReset(device, true));
+    EXPECT_NE(nullptr, device->pSampler);
+}
+
 TEST_F(SysmanGlobalOperationsIntegratedFixture,
        GivenPermissionDeniedWhenCallingGetDeviceStateThenZeResultErrorInsufficientPermissionsIsReturned) {
 
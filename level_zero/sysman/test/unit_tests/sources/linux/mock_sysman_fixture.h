@@ -142,6 +142,9 @@ class PublicFsAccess : public L0::Sysman::FsAccess {
 class PublicSysfsAccess : public L0::Sysman::SysfsAccess {
   public:
     using SysfsAccess::accessSyscall;
+    using SysfsAccess::dirname;
+    using SysfsAccess::writeCache;
+    using SysfsAccess::writeCacheEnabled;
 };
 
 } // namespace ult
@@ -153,6 +153,7 @@ class PublicPlatformMonitoringTech : public L0::Sysman::PlatformMonitoringTech {
     using PlatformMonitoringTech::preadFunction;
     using PlatformMonitoringTech::rootDeviceTelemNodeIndex;
     using PlatformMonitoringTech::telemetryDeviceEntry;
+    using PlatformMonitoringTech::telemetryFd;
 };
 
 } // namespace ult
@@ -144,7 +144,7 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint3
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
-TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint32TypeAndCloseSysCallFailsThenreadValueFails) {
+TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint32TypeAndCloseSysCallFailsThenreadValueSucceedsAsTelemetryFileIsKeptOpen) {
     auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
     pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
     pPmt->openFunction = openMock;
@@ -153,7 +153,8 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint3
 
     uint32_t val = 0;
     pPmt->keyOffsetMap = dummyKeyOffsetMap;
-    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(fakeFileDescriptor, pPmt->telemetryFd);
 }
 
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint64TypeAndOpenSysCallFailsThenreadValueFails) {
@@ -165,7 +166,7 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint6
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
-TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint64TypeAndCloseSysCallFailsThenreadValueFails) {
+TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint64TypeAndCloseSysCallFailsThenreadValueSucceedsAsTelemetryFileIsKeptOpen) {
     auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
     pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
     pPmt->openFunction = openMock;
@@ -174,7 +175,8 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint6
 
     uint64_t val = 0;
     pPmt->keyOffsetMap = dummyKeyOffsetMap;
-    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(fakeFileDescriptor, pPmt->telemetryFd);
 }
 
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint32TypeAndPreadSysCallFailsThenreadValueFails) {
@@ -201,6 +203,217 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint6
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
+struct FakeTelemetryFile {
+    static constexpr size_t size = 0x1000;
+    static uint8_t data[size];
+    static uint32_t openCount;
+    static uint32_t closeCount;
+    static uint32_t preadCount;
+
+    static void reset() {
+        openCount = 0;
+        closeCount = 0;
+        preadCount = 0;
+        for (size_t i = 0; i < size; i++) {
+            data[i] = static_cast<uint8_t>(i * 7 + 3);
+        }
+    }
+
+    static int open(const char *pathname, int flags) {
+        openCount++;
+        return fakeFileDescriptor;
+    }
+
+    static int close(int fd) {
+        closeCount++;
+        return 0;
+    }
+
+    static ssize_t pread(int fd, void *buf, size_t count, off_t offset) {
+        preadCount++;
+        if (static_cast<size_t>(offset) + count > size) {
+            return -1;
+        }
+        memcpy(buf, data + offset, count);
+        return count;
+    }
+};
+uint8_t FakeTelemetryFile::data[FakeTelemetryFile::size];
+uint32_t FakeTelemetryFile::openCount = 0;
+uint32_t FakeTelemetryFile::closeCount = 0;
+uint32_t FakeTelemetryFile::preadCount = 0;
+
+const std::map<std::string, uint64_t> fakeTelemetryKeyOffsetMap = {
+    {"PACKAGE_ENERGY", 0x420},
+    {"SOC_TEMPERATURES", 0x60},
+    {"XTAL_CLK_FREQUENCY", 0x448},
+    {"VF0_HBM0_READ", 0x124},
+    {"VF0_HBM0_WRITE", 0x128},
+    {"VF0_TIMESTAMP_L", 0x0},
+    {"VF0_TIMESTAMP_H", 0x4}};
+
+class ZesPmtFakeTelemetryFileFixture : public ZesPmtFixtureMultiDevice {
+  protected:
+    std::unique_ptr<PublicPlatformMonitoringTech> pPmt;
+    void SetUp() override {
+        ZesPmtFixtureMultiDevice::SetUp();
+        FakeTelemetryFile::reset();
+        pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+        pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+        pPmt->keyOffsetMap = fakeTelemetryKeyOffsetMap;
+        pPmt->openFunction = FakeTelemetryFile::open;
+        pPmt->closeFunction = FakeTelemetryFile::close;
+        pPmt->preadFunction = FakeTelemetryFile::pread;
+    }
+    void TearDown() override {
+        pPmt.reset();
+        ZesPmtFixtureMultiDevice::TearDown();
+    }
+};
+
+TEST_F(ZesPmtFakeTelemetryFileFixture, GivenPmtObjectWhenReadingValuesRepeatedlyThenTelemetryFileIsOpenedOnceAndClosedOnDestruction) {
+    for (uint32_t i = 0; i < 10; i++) {
+        uint64_t energy = 0;
+        uint32_t temperature = 0;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("PACKAGE_ENERGY", energy));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("SOC_TEMPERATURES", temperature));
+    }
+    EXPECT_EQ(1u, FakeTelemetryFile::openCount);
+    EXPECT_EQ(20u, FakeTelemetryFile::preadCount);
+    EXPECT_EQ(0u, FakeTelemetryFile::closeCount);
+
+    pPmt.reset();
+    EXPECT_EQ(1u, FakeTelemetryFile::closeCount);
+}
+
+TEST_F(ZesPmtFakeTelemetryFileFixture, GivenKeysWhenGettingKeyOffsetsThenOffsetsFromKeyOffsetMapAreReturned) {
+    std::vector<uint64_t> offsets;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->getKeyOffsets({"VF0_HBM0_READ", "PACKAGE_ENERGY", "VF0_TIMESTAMP_L"}, offsets));
+    ASSERT_EQ(3u, offsets.size());
+    EXPECT_EQ(0x124u, offsets[0]);
+    EXPECT_EQ(0x420u, offsets[1]);
+    EXPECT_EQ(0x0u, offsets[2]);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pPmt->getKeyOffsets({"VF0_HBM0_READ", "SOMETHING"}, offsets));
+}
+
+TEST_F(ZesPmtFakeTelemetryFileFixture, GivenResolvedOffsetsWhenReadingValuesThenWholeWindowIsReadWithSinglePreadAndValuesMatchReadValue) {
+    std::vector<std::string> keys32 = {"VF0_HBM0_READ", "VF0_HBM0_WRITE", "VF0_TIMESTAMP_L", "VF0_TIMESTAMP_H", "SOC_TEMPERATURES"};
+    std::vector<std::string> keys64 = {"PACKAGE_ENERGY", "XTAL_CLK_FREQUENCY"};
+    std::vector<uint64_t> offsets32;
+    std::vector<uint64_t> offsets64;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, pPmt->getKeyOffsets(keys32, offsets32));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, pPmt->getKeyOffsets(keys64, offsets64));
+
+    std::vector<uint32_t> values32;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValues(offsets32, values32));
+    EXPECT_EQ(1u, FakeTelemetryFile::preadCount);
+    std::vector<uint64_t> values64;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValues(offsets64, values64));
+    EXPECT_EQ(2u, FakeTelemetryFile::preadCount);
+
+    ASSERT_EQ(keys32.size(), values32.size());
+    for (size_t i = 0; i < keys32.size(); i++) {
+        uint32_t value = 0;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue(keys32[i], value));
+        EXPECT_EQ(value, values32[i]);
+    }
+    ASSERT_EQ(keys64.size(), values64.size());
+    for (size_t i = 0; i < keys64.size(); i++) {
+        uint64_t value = 0;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue(keys64[i], value));
+        EXPECT_EQ(value, values64[i]);
+    }
+    EXPECT_EQ(1u, FakeTelemetryFile::openCount);
+}
+
+TEST_F(ZesPmtFakeTelemetryFileFixture, GivenFullCounterSetWhenSamplingWithReadValuesInsteadOfReadValueThenSyscallCountIsReduced) {
+    constexpr uint32_t numSamples = 100;
+    std::vector<std::string> keys;
+    for (auto &keyOffset : fakeTelemetryKeyOffsetMap) {
+        keys.push_back(keyOffset.first);
+    }
+
+    for (uint32_t sample = 0; sample < numSamples; sample++) {
+        for (auto &key : keys) {
+            uint64_t value = 0;
+            EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue(key, value));
+        }
+    }
+    auto preadCountPerKey = FakeTelemetryFile::preadCount;
+    EXPECT_EQ(numSamples * keys.size(), preadCountPerKey);
+
+    FakeTelemetryFile::preadCount = 0;
+    std::vector<uint64_t> offsets;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, pPmt->getKeyOffsets(keys, offsets));
+    std::vector<uint64_t> values;
+    for (uint32_t sample = 0; sample < numSamples; sample++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValues(offsets, values));
+    }
+    EXPECT_EQ(numSamples, FakeTelemetryFile::preadCount);
+    EXPECT_EQ(1u, FakeTelemetryFile::openCount);
+    EXPECT_EQ(0u, FakeTelemetryFile::closeCount);
+}
+
+TEST_F(ZesPmtFakeTelemetryFileFixture, GivenEmptyOffsetsWhenReadingValuesThenErrorIsReturned) {
+    std::vector<uint32_t> values32;
+    std::vector<uint64_t> values64;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, pPmt->readValues(std::vector<uint64_t>{}, values32));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, pPmt->readValues(std::vector<uint64_t>{}, values64));
+    EXPECT_EQ(0u, FakeTelemetryFile::preadCount);
+}
+
+TEST_F(ZesPmtFakeTelemetryFileFixture, GivenWindowExceedingTelemetryFileWhenReadingValuesThenErrorIsReturned) {
+    std::vector<uint64_t> offsets = {0x0, FakeTelemetryFile::size};
+    std::vector<uint32_t> values32;
+    std::vector<uint64_t> values64;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValues(offsets, values32));
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValues(offsets, values64));
+}
+
+TEST_F(ZesPmtFakeTelemetryFileFixture, GivenPreadSysCallFailsWhenReadingValueThenTelemetryFileIsClosedAndReopenedOnNextRead) {
+    pPmt->preadFunction = preadMockPmtFailure;
+    uint64_t value = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("PACKAGE_ENERGY", value));
+    EXPECT_EQ(1u, FakeTelemetryFile::openCount);
+    EXPECT_EQ(1u, FakeTelemetryFile::closeCount);
+    EXPECT_EQ(-1, pPmt->telemetryFd);
+
+    pPmt->preadFunction = FakeTelemetryFile::pread;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("PACKAGE_ENERGY", value));
+    EXPECT_EQ(2u, FakeTelemetryFile::openCount);
+    EXPECT_EQ(1u, FakeTelemetryFile::closeCount);
+}
+
+TEST_F(ZesPmtFakeTelemetryFileFixture, GivenKeysWhenReadingValuesByKeyThenAllKeysAreReadWithSinglePread) {
+    std::vector<std::string> keys = {"VF0_HBM0_READ", "VF0_HBM0_WRITE", "VF0_TIMESTAMP_L"};
+    std::vector<uint32_t> values;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValues(keys, values));
+    EXPECT_EQ(1u, FakeTelemetryFile::preadCount);
+
+    ASSERT_EQ(keys.size(), values.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        uint32_t value = 0;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue(keys[i], value));
+        EXPECT_EQ(value, values[i]);
+    }
+
+    std::vector<uint64_t> values64;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pPmt->readValues(std::vector<std::string>{"PACKAGE_ENERGY", "SOMETHING"}, values64));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pPmt->readValues(std::vector<std::string>{"SOMETHING"}, values));
+}
+
+TEST_F(ZesPmtFakeTelemetryFileFixture, GivenOpenSysCallFailsWhenReadingValuesThenErrorIsReturnedAndOpenIsRetriedOnNextRead) {
+    pPmt->openFunction = openMockReturnFailure;
+    std::vector<uint64_t> offsets = {0x0};
+    std::vector<uint32_t> values;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValues(offsets, values));
+
+    pPmt->openFunction = FakeTelemetryFile::open;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValues(offsets, values));
+    EXPECT_EQ(1u, FakeTelemetryFile::openCount);
+}
+
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenDoingPMTInitThenPMTmapOfSubDeviceIdToPmtObjectWouldContainValidEntries) {
     std::map<uint32_t, L0::Sysman::PlatformMonitoringTech *> mapOfSubDeviceIdToPmtObject;
     auto subDeviceCount = pLinuxSysmanImp->getSubDeviceCount();
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/sysman/test/unit_tests/sources/linux/mock_sysman_fixture.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace L0 {
+namespace ult {
+
+// Stands in for the sysfs directory of a device with a temporary directory of regular files
+class SysfsWriteCacheFixture : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        char tempDirTemplate[] = "/tmp/sysman_sysfs_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(tempDirTemplate));
+        tempDir = tempDirTemplate;
+
+        for (const auto &attribute : attributes) {
+            std::ofstream file(tempDir + "/" + attribute);
+            file << 0 << std::endl;
+        }
+
+        pSysfsAccess = std::make_unique<PublicSysfsAccess>();
+        pSysfsAccess->dirname = tempDir + "/";
+    }
+
+    void TearDown() override {
+        for (const auto &attribute : attributes) {
+            std::remove((tempDir + "/" + attribute).c_str());
+        }
+        rmdir(tempDir.c_str());
+    }
+
+    std::string readAttribute(const std::string &attribute) {
+        std::ifstream file(tempDir + "/" + attribute);
+        std::string value;
+        std::getline(file, value);
+        return value;
+    }
+
+    void overwriteAttribute(const std::string &attribute, const std::string &value) {
+        std::ofstream file(tempDir + "/" + attribute, std::ios::trunc);
+        file << value << std::endl;
+    }
+
+    const std::vector<std::string> attributes = {"gt_min_freq_mhz", "gt_max_freq_mhz", "power1_max", "power1_max_interval"};
+    std::string tempDir;
+    std::unique_ptr<PublicSysfsAccess> pSysfsAccess;
+};
+
+TEST_F(SysfsWriteCacheFixture, GivenWriteCacheDisabledWhenWritingSameValueTwiceThenBothWritesReachFile) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pSysfsAccess->write("gt_min_freq_mhz", 300.0));
+    overwriteAttribute("gt_min_freq_mhz", "0");
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pSysfsAccess->write("gt_min_freq_mhz", 300.0));
+    EXPECT_EQ("300", readAttribute("gt_min_freq_mhz"));
+    EXPECT_TRUE(pSysfsAccess->writeCache.empty());
+}
+
+TEST_F(SysfsWriteCacheFixture, GivenWriteCacheEnabledWhenWritingSameValueTwiceThenSecondWriteIsSkipped) {
+    pSysfsAccess->writeCacheEnabled = true;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pSysfsAccess->write("power1_max", static_cast<uint64_t>(150000000)));
+    overwriteAttribute("power1_max", "0");
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pSysfsAccess->write("power1_max", static_cast<uint64_t>(150000000)));
+    EXPECT_EQ("0", readAttribute("power1_max"));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pSysfsAccess->write("power1_max", static_cast<uint64_t>(120000000)));
+    EXPECT_EQ("120000000", readAttribute("power1_max"));
+}
+
+TEST_F(SysfsWriteCacheFixture, GivenWriteCacheEnabledWhenCacheIsInvalidatedThenNextWriteReachesFile) {
+    pSysfsAccess->writeCacheEnabled = true;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pSysfsAccess->write("gt_max_freq_mhz", 1100.0));
+    overwriteAttribute("gt_max_freq_mhz", "900");
+    pSysfsAccess->invalidateWriteCache();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pSysfsAccess->write("gt_max_freq_mhz", 1100.0));
+    EXPECT_EQ("1100", readAttribute("gt_max_freq_mhz"));
+}
+
+TEST_F(SysfsWriteCacheFixture, GivenWriteCacheEnabledWhenWriteFailsThenValueIsNotCached) {
+    pSysfsAccess->writeCacheEnabled = true;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, pSysfsAccess->write("missing_dir/power1_max", 1));
+    EXPECT_TRUE(pSysfsAccess->writeCache.empty());
+}
+
+TEST_F(SysfsWriteCacheFixture, GivenWriteCacheEnabledWhenThreadsWriteDifferentAttributesConcurrentlyThenEveryAttributeHoldsAndCachesItsValue) {
+    pSysfsAccess->writeCacheEnabled = true;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < attributes.size(); i++) {
+        threads.emplace_back([&, i]() {
+            for (int value = 1; value <= 100; value++) {
+                EXPECT_EQ(ZE_RESULT_SUCCESS, pSysfsAccess->write(attributes[i], value * static_cast<int>(i + 1)));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(attributes.size(), pSysfsAccess->writeCache.size());
+    for (size_t i = 0; i < attributes.size(); i++) {
+        auto expectedValue = std::to_string(100 * (i + 1));
+        EXPECT_EQ(expectedValue, readAttribute(attributes[i]));
+        EXPECT_EQ(expectedValue, pSysfsAccess->writeCache[attributes[i]]);
+    }
+}
+
+TEST_F(SysmanDeviceFixture, GivenEnableSysmanSysfsWriteCacheDebugKeyWhenCreatingSysfsAccessThenWriteCacheIsEnabled) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSysmanSysfsWriteCache.set(1);
+
+    std::unique_ptr<L0::Sysman::SysfsAccess> pSysfsAccess(L0::Sysman::SysfsAccess::create(""));
+    auto pPublicSysfsAccess = static_cast<PublicSysfsAccess *>(pSysfsAccess.get());
+    EXPECT_TRUE(pPublicSysfsAccess->writeCacheEnabled);
+}
+
+} // namespace ult
+} // namespace L0
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "level_zero/sysman/source/engine/sysman_engine_imp.h"
+#include "level_zero/sysman/source/engine/sysman_os_engine.h"
+#include "level_zero/sysman/source/sampler/sysman_sampler.h"
+#include "level_zero/sysman/source/temperature/sysman_os_temperature.h"
+#include "level_zero/sysman/source/temperature/sysman_temperature_imp.h"
+
+namespace L0 {
+namespace ult {
+
+class MockSamplerOsTemperature : public L0::Sysman::OsTemperature {
+  public:
+    ze_result_t getProperties(zes_temp_properties_t *pProperties) override { return ZE_RESULT_SUCCESS; }
+    ze_result_t getSensorTemperature(double *pTemperature) override {
+        getSensorTemperatureCalled++;
+        *pTemperature = mockTemperature;
+        return mockResult;
+    }
+    bool isTempModuleSupported() override { return true; }
+
+    uint32_t getSensorTemperatureCalled = 0u;
+    double mockTemperature = 0.0;
+    ze_result_t mockResult = ZE_RESULT_SUCCESS;
+};
+
+class MockSamplerOsEngine : public L0::Sysman::OsEngine {
+  public:
+    ze_result_t getActivity(zes_engine_stats_t *pStats) override {
+        getActivityCalled++;
+        pStats->activeTime = mockActiveTime;
+        pStats->timestamp = mockTimestamp;
+        return ZE_RESULT_SUCCESS;
+    }
+    ze_result_t getProperties(zes_engine_properties_t &properties) override { return ZE_RESULT_SUCCESS; }
+    bool isEngineModuleSupported() override { return true; }
+
+    uint32_t getActivityCalled = 0u;
+    uint64_t mockActiveTime = 0u;
+    uint64_t mockTimestamp = 0u;
+};
+
+class MockSysmanSampler : public L0::Sysman::SysmanSampler {
+  public:
+    using SysmanSampler::attachToHandles;
+    using SysmanSampler::engineHandles;
+    using SysmanSampler::frequencyHandles;
+    using SysmanSampler::memoryHandles;
+    using SysmanSampler::powerHandles;
+    using SysmanSampler::privateRingStorage;
+    using SysmanSampler::sharedMemory;
+    using SysmanSampler::temperatureHandles;
+
+    MockSysmanSampler(L0::Sysman::SysmanDeviceImp *pSysmanDevice, uint32_t periodMs, uint32_t counterMask, bool serveQueries)
+        : SysmanSampler(pSysmanDevice, periodMs, counterMask, ringCapacity, serveQueries) {}
+
+    uint64_t getCurrentTimeNs() const override {
+        if (mockCurrentTimeNs != 0u) {
+            return mockCurrentTimeNs;
+        }
+        return SysmanSampler::getCurrentTimeNs();
+    }
+
+    static constexpr uint32_t ringCapacity = 4u;
+    uint64_t mockCurrentTimeNs = 0u;
+};
+
+} // namespace ult
+} // namespace L0
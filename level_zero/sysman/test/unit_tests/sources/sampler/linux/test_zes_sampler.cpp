@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "level_zero/sysman/source/sampler/sysman_shared_memory.h"
+#include "level_zero/sysman/test/unit_tests/sources/linux/mock_sysman_fixture.h"
+#include "level_zero/sysman/test/unit_tests/sources/sampler/linux/mock_sampler.h"
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <unistd.h>
+
+namespace L0 {
+namespace ult {
+
+using L0::Sysman::SysmanSample;
+using L0::Sysman::SysmanSampledCounter;
+using L0::Sysman::SysmanSampleEntry;
+using L0::Sysman::SysmanSampler;
+
+static double bitsToDouble(uint64_t bits) {
+    double value = 0.0;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+class ZesSysmanSamplerFixture : public SysmanDeviceFixture {
+  protected:
+    void SetUp() override {
+        SysmanDeviceFixture::SetUp();
+        for (uint32_t i = 0; i < numTemperatureHandles; i++) {
+            auto pTemperature = std::make_unique<L0::Sysman::TemperatureImp>();
+            auto pOsTemperature = std::make_unique<MockSamplerOsTemperature>();
+            pOsTemperature->mockTemperature = 40.5 + i;
+            pOsTemperatures.push_back(pOsTemperature.get());
+            pTemperature->pOsTemperature = std::move(pOsTemperature);
+            temperatures.push_back(std::move(pTemperature));
+        }
+        engine = std::make_unique<L0::Sysman::EngineImp>();
+        auto pOsEngine = std::make_unique<MockSamplerOsEngine>();
+        pOsEngine->mockActiveTime = 700u;
+        pOsEngine->mockTimestamp = 1500u;
+        pOsEngineMock = pOsEngine.get();
+        engine->pOsEngine = std::move(pOsEngine);
+    }
+
+    void TearDown() override {
+        SysmanDeviceFixture::TearDown();
+    }
+
+    std::unique_ptr<MockSysmanSampler> createSampler(bool serveQueries) {
+        auto sampler = std::make_unique<MockSysmanSampler>(pSysmanDeviceImp, periodMs, SysmanSampler::allCounters, serveQueries);
+        EXPECT_TRUE(sampler->initRing(""));
+        for (auto &temperature : temperatures) {
+            sampler->temperatureHandles.push_back(temperature.get());
+        }
+        sampler->engineHandles.push_back(engine.get());
+        sampler->attachToHandles();
+        return sampler;
+    }
+
+    static constexpr uint32_t numTemperatureHandles = 2u;
+    static constexpr uint32_t periodMs = 1000u;
+    DebugManagerStateRestore restorer;
+    std::vector<std::unique_ptr<L0::Sysman::TemperatureImp>> temperatures;
+    std::vector<MockSamplerOsTemperature *> pOsTemperatures;
+    std::unique_ptr<L0::Sysman::EngineImp> engine;
+    MockSamplerOsEngine *pOsEngineMock = nullptr;
+};
+
+TEST_F(ZesSysmanSamplerFixture, GivenSamplerNotEnabledWhenCreatingSamplerThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, SysmanSampler::create(pSysmanDeviceImp));
+    DebugManager.flags.EnableSysmanSampler.set(0);
+    EXPECT_EQ(nullptr, SysmanSampler::create(pSysmanDeviceImp));
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenSamplerEnabledWithoutCountersWhenCreatingSamplerThenSamplerWithProcessPrivateRingIsReturned) {
+    DebugManager.flags.EnableSysmanSampler.set(1);
+    DebugManager.flags.SysmanSamplerCounterMask.set(0);
+    DebugManager.flags.SysmanSamplerPeriodMs.set(20);
+    DebugManager.flags.SysmanSamplerRingCapacity.set(3);
+
+    auto sampler = SysmanSampler::create(pSysmanDeviceImp);
+    ASSERT_NE(nullptr, sampler);
+    auto pSampler = static_cast<MockSysmanSampler *>(sampler.get());
+    EXPECT_EQ(20u, sampler->getPeriodMs());
+    ASSERT_NE(nullptr, sampler->getRing());
+    EXPECT_EQ(3u, sampler->getRing()->getCapacity());
+    EXPECT_NE(nullptr, pSampler->privateRingStorage);
+    EXPECT_EQ(nullptr, pSampler->sharedMemory);
+    EXPECT_TRUE(pSampler->powerHandles.empty());
+    EXPECT_TRUE(pSampler->temperatureHandles.empty());
+    EXPECT_TRUE(pSampler->frequencyHandles.empty());
+    EXPECT_TRUE(pSampler->engineHandles.empty());
+    EXPECT_TRUE(pSampler->memoryHandles.empty());
+
+    sampler->sampleOnce();
+    EXPECT_EQ(1u, sampler->getRing()->getWriteCount());
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenSharedMemoryNameWhenCreatingSamplerThenSamplesAreReadableThroughSeparateMappingOfSharedMemory) {
+    std::string sharedMemoryName = "neo_sysman_sampler_ult_" + std::to_string(getpid());
+    DebugManager.flags.EnableSysmanSampler.set(1);
+    DebugManager.flags.SysmanSamplerCounterMask.set(0);
+    DebugManager.flags.SysmanSamplerSharedMemoryName.set(sharedMemoryName);
+
+    auto sampler = SysmanSampler::create(pSysmanDeviceImp);
+    ASSERT_NE(nullptr, sampler);
+    EXPECT_NE(nullptr, static_cast<MockSysmanSampler *>(sampler.get())->sharedMemory);
+    sampler->sampleOnce();
+    sampler->sampleOnce();
+
+    auto readerMemory = L0::Sysman::SysmanSharedMemory::open(sharedMemoryName + "_" + std::to_string(pSysmanDeviceImp->getRootDeviceIndex()));
+    ASSERT_NE(nullptr, readerMemory);
+    auto readerRing = L0::Sysman::SysmanSampleRing::attach(readerMemory->getMemory(), readerMemory->getSize());
+    ASSERT_NE(nullptr, readerRing);
+    auto sample = std::make_unique<SysmanSample>();
+    ASSERT_TRUE(readerRing->readLatest(*sample));
+    EXPECT_EQ(1u, sample->sequence);
+
+    readerRing.reset();
+    readerMemory.reset();
+    sampler.reset();
+    EXPECT_EQ(nullptr, L0::Sysman::SysmanSharedMemory::open(sharedMemoryName + "_" + std::to_string(pSysmanDeviceImp->getRootDeviceIndex())));
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenSharedMemoryAlreadyCreatedWhenCreatingItAgainThenCreationFailsAndExistingOwnerKeepsIt) {
+    std::string sharedMemoryName = "neo_sysman_shared_memory_ult_" + std::to_string(getpid());
+    constexpr size_t size = 4096u;
+
+    auto owner = L0::Sysman::SysmanSharedMemory::create(sharedMemoryName, size);
+    ASSERT_NE(nullptr, owner);
+    EXPECT_EQ(nullptr, L0::Sysman::SysmanSharedMemory::create(sharedMemoryName, size));
+
+    auto reader = L0::Sysman::SysmanSharedMemory::open(sharedMemoryName);
+    ASSERT_NE(nullptr, reader);
+    EXPECT_EQ(size, reader->getSize());
+
+    reader.reset();
+    owner.reset();
+    EXPECT_EQ(nullptr, L0::Sysman::SysmanSharedMemory::open(sharedMemoryName));
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenSharedMemoryNameInUseWhenCreatingSamplerThenSamplerFallsBackToProcessPrivateRing) {
+    std::string sharedMemoryName = "neo_sysman_sampler_in_use_ult_" + std::to_string(getpid());
+    DebugManager.flags.EnableSysmanSampler.set(1);
+    DebugManager.flags.SysmanSamplerCounterMask.set(0);
+    DebugManager.flags.SysmanSamplerSharedMemoryName.set(sharedMemoryName);
+
+    auto firstSampler = SysmanSampler::create(pSysmanDeviceImp);
+    ASSERT_NE(nullptr, firstSampler);
+    EXPECT_NE(nullptr, static_cast<MockSysmanSampler *>(firstSampler.get())->sharedMemory);
+
+    auto secondSampler = SysmanSampler::create(pSysmanDeviceImp);
+    ASSERT_NE(nullptr, secondSampler);
+    EXPECT_EQ(nullptr, static_cast<MockSysmanSampler *>(secondSampler.get())->sharedMemory);
+    EXPECT_NE(nullptr, static_cast<MockSysmanSampler *>(secondSampler.get())->privateRingStorage);
+
+    secondSampler.reset();
+    EXPECT_NE(nullptr, L0::Sysman::SysmanSharedMemory::open(sharedMemoryName + "_" + std::to_string(pSysmanDeviceImp->getRootDeviceIndex())));
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenRegisteredHandlesWhenSamplingOnceThenEntryForEachHandleIsPublished) {
+    auto sampler = createSampler(false);
+    sampler->sampleOnce();
+
+    auto sample = std::make_unique<SysmanSample>();
+    ASSERT_TRUE(sampler->getRing()->readLatest(*sample));
+    ASSERT_EQ(numTemperatureHandles + 1, sample->numEntries);
+    for (uint32_t i = 0; i < numTemperatureHandles; i++) {
+        EXPECT_EQ(SysmanSampledCounter::temperature, sample->entries[i].counter);
+        EXPECT_EQ(i, sample->entries[i].handleIndex);
+        EXPECT_EQ(40.5 + i, bitsToDouble(sample->entries[i].values[0]));
+        EXPECT_EQ(1u, pOsTemperatures[i]->getSensorTemperatureCalled);
+    }
+    auto &engineEntry = sample->entries[numTemperatureHandles];
+    EXPECT_EQ(SysmanSampledCounter::engineActivity, engineEntry.counter);
+    EXPECT_EQ(0u, engineEntry.handleIndex);
+    EXPECT_EQ(700u, engineEntry.values[0]);
+    EXPECT_EQ(1500u, engineEntry.timestamp);
+    EXPECT_EQ(1u, pOsEngineMock->getActivityCalled);
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenFailingCounterReadWhenSamplingOnceThenEntryForThatHandleIsSkipped) {
+    auto sampler = createSampler(false);
+    pOsTemperatures[0]->mockResult = ZE_RESULT_ERROR_NOT_AVAILABLE;
+    sampler->sampleOnce();
+
+    auto sample = std::make_unique<SysmanSample>();
+    ASSERT_TRUE(sampler->getRing()->readLatest(*sample));
+    ASSERT_EQ(numTemperatureHandles, sample->numEntries);
+    EXPECT_EQ(SysmanSampledCounter::temperature, sample->entries[0].counter);
+    EXPECT_EQ(1u, sample->entries[0].handleIndex);
+
+    SysmanSampleEntry entry = {};
+    EXPECT_FALSE(sampler->getLatestEntry(SysmanSampledCounter::temperature, 0u, entry));
+    EXPECT_TRUE(sampler->getLatestEntry(SysmanSampledCounter::temperature, 1u, entry));
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenServeQueriesEnabledAndRecentSampleWhenQueryingHandlesThenValuesAreAnsweredFromSampleWithoutDeviceAccess) {
+    auto sampler = createSampler(true);
+    sampler->sampleOnce();
+
+    for (uint32_t query = 0; query < 5; query++) {
+        for (uint32_t i = 0; i < numTemperatureHandles; i++) {
+            double temperature = 0.0;
+            EXPECT_EQ(ZE_RESULT_SUCCESS, temperatures[i]->temperatureGetState(&temperature));
+            EXPECT_EQ(40.5 + i, temperature);
+        }
+        zes_engine_stats_t stats = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, engine->engineGetActivity(&stats));
+        EXPECT_EQ(700u, stats.activeTime);
+        EXPECT_EQ(1500u, stats.timestamp);
+    }
+    for (uint32_t i = 0; i < numTemperatureHandles; i++) {
+        EXPECT_EQ(1u, pOsTemperatures[i]->getSensorTemperatureCalled);
+    }
+    EXPECT_EQ(1u, pOsEngineMock->getActivityCalled);
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenServeQueriesDisabledWhenQueryingHandlesThenDeviceIsRead) {
+    auto sampler = createSampler(false);
+    sampler->sampleOnce();
+
+    double temperature = 0.0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, temperatures[0]->temperatureGetState(&temperature));
+    zes_engine_stats_t stats = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, engine->engineGetActivity(&stats));
+    EXPECT_EQ(2u, pOsTemperatures[0]->getSensorTemperatureCalled);
+    EXPECT_EQ(2u, pOsEngineMock->getActivityCalled);
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenServeQueriesEnabledAndNoSampleYetWhenQueryingHandlesThenDeviceIsRead) {
+    auto sampler = createSampler(true);
+
+    double temperature = 0.0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, temperatures[0]->temperatureGetState(&temperature));
+    EXPECT_EQ(40.5, temperature);
+    EXPECT_EQ(1u, pOsTemperatures[0]->getSensorTemperatureCalled);
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenServeQueriesEnabledAndStaleSampleWhenQueryingHandlesThenDeviceIsRead) {
+    auto sampler = createSampler(true);
+    sampler->mockCurrentTimeNs = 1000u;
+    sampler->sampleOnce();
+
+    double temperature = 0.0;
+    sampler->mockCurrentTimeNs = 1000u + 2ull * periodMs * 1000000ull;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, temperatures[0]->temperatureGetState(&temperature));
+    EXPECT_EQ(1u, pOsTemperatures[0]->getSensorTemperatureCalled);
+
+    sampler->mockCurrentTimeNs += 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, temperatures[0]->temperatureGetState(&temperature));
+    EXPECT_EQ(2u, pOsTemperatures[0]->getSensorTemperatureCalled);
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenSamplerDestroyedWhenQueryingHandlesThenHandlesAreDetachedAndDeviceIsRead) {
+    auto sampler = createSampler(true);
+    sampler->sampleOnce();
+    EXPECT_EQ(sampler.get(), temperatures[0]->pSampler);
+    EXPECT_EQ(1u, temperatures[1]->samplerHandleIndex);
+    sampler.reset();
+
+    EXPECT_EQ(nullptr, temperatures[0]->pSampler);
+    EXPECT_EQ(nullptr, engine->pSampler);
+    double temperature = 0.0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, temperatures[0]->temperatureGetState(&temperature));
+    EXPECT_EQ(2u, pOsTemperatures[0]->getSensorTemperatureCalled);
+}
+
+TEST_F(ZesSysmanSamplerFixture, GivenStartedSamplerWhenWaitingThenSamplesArePublishedPeriodicallyUntilStopped) {
+    auto sampler = std::make_unique<MockSysmanSampler>(pSysmanDeviceImp, 1u, SysmanSampler::allCounters, false);
+    ASSERT_TRUE(sampler->initRing(""));
+    sampler->start();
+    sampler->start();
+
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (sampler->getRing()->getWriteCount() < 3u && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::yield();
+    }
+    sampler->stop();
+    auto writeCount = sampler->getRing()->getWriteCount();
+    EXPECT_GE(writeCount, 3u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(writeCount, sampler->getRing()->getWriteCount());
+}
+
+} // namespace ult
+} // namespace L0
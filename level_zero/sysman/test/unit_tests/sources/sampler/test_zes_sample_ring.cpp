@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/sampler/sysman_sample_ring.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace L0 {
+namespace ult {
+
+using L0::Sysman::SysmanSample;
+using L0::Sysman::SysmanSampledCounter;
+using L0::Sysman::SysmanSampleRing;
+
+class SysmanSampleRingTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        storage.resize(SysmanSampleRing::getRequiredSize(capacity) / sizeof(uint64_t) + 1);
+        ring = SysmanSampleRing::create(storage.data(), storage.size() * sizeof(uint64_t), capacity);
+        ASSERT_NE(nullptr, ring);
+        sample = std::make_unique<SysmanSample>();
+        memset(sample.get(), 0, sizeof(SysmanSample));
+    }
+
+    static constexpr uint32_t capacity = 4u;
+    std::vector<uint64_t> storage;
+    std::unique_ptr<SysmanSampleRing> ring;
+    std::unique_ptr<SysmanSample> sample;
+};
+
+TEST_F(SysmanSampleRingTest, GivenEmptyRingWhenReadingLatestSampleThenFalseIsReturned) {
+    EXPECT_EQ(0u, ring->getWriteCount());
+    EXPECT_EQ(capacity, ring->getCapacity());
+    EXPECT_FALSE(ring->readLatest(*sample));
+    EXPECT_FALSE(ring->readSample(0u, *sample));
+}
+
+TEST_F(SysmanSampleRingTest, GivenPublishedSamplesWhenReadingThenLatestAndRetainedSamplesAreReturnedAndOverwrittenOnesAreRejected) {
+    for (uint32_t i = 0; i < capacity + 2; i++) {
+        sample->timestamp = 1000u + i;
+        sample->numEntries = 1u;
+        sample->entries[0].counter = SysmanSampledCounter::energy;
+        sample->entries[0].values[0] = i;
+        ring->publish(*sample);
+    }
+    EXPECT_EQ(capacity + 2u, ring->getWriteCount());
+
+    auto readSample = std::make_unique<SysmanSample>();
+    ASSERT_TRUE(ring->readLatest(*readSample));
+    EXPECT_EQ(capacity + 1u, readSample->sequence);
+    EXPECT_EQ(1000u + capacity + 1u, readSample->timestamp);
+    EXPECT_EQ(capacity + 1u, readSample->entries[0].values[0]);
+
+    ASSERT_TRUE(ring->readSample(2u, *readSample));
+    EXPECT_EQ(2u, readSample->sequence);
+    EXPECT_EQ(2u, readSample->entries[0].values[0]);
+
+    EXPECT_FALSE(ring->readSample(1u, *readSample));
+    EXPECT_FALSE(ring->readSample(capacity + 2u, *readSample));
+}
+
+TEST_F(SysmanSampleRingTest, GivenInitializedRingMemoryWhenAttachingThenReaderSeesPublishedSamples) {
+    sample->timestamp = 123u;
+    ring->publish(*sample);
+
+    auto reader = SysmanSampleRing::attach(storage.data(), storage.size() * sizeof(uint64_t));
+    ASSERT_NE(nullptr, reader);
+    EXPECT_EQ(capacity, reader->getCapacity());
+    auto readSample = std::make_unique<SysmanSample>();
+    ASSERT_TRUE(reader->readLatest(*readSample));
+    EXPECT_EQ(123u, readSample->timestamp);
+}
+
+TEST_F(SysmanSampleRingTest, GivenInvalidMemoryWhenCreatingOrAttachingRingThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, SysmanSampleRing::create(nullptr, storage.size() * sizeof(uint64_t), capacity));
+    EXPECT_EQ(nullptr, SysmanSampleRing::create(storage.data(), SysmanSampleRing::getRequiredSize(capacity) - 1, capacity));
+    EXPECT_EQ(nullptr, SysmanSampleRing::create(storage.data(), storage.size() * sizeof(uint64_t), 0u));
+    EXPECT_EQ(nullptr, SysmanSampleRing::attach(storage.data(), SysmanSampleRing::getRequiredSize(capacity) - 1));
+
+    std::vector<uint64_t> garbage(storage.size(), 0xdeadbeefu);
+    EXPECT_EQ(nullptr, SysmanSampleRing::attach(garbage.data(), garbage.size() * sizeof(uint64_t)));
+}
+
+TEST_F(SysmanSampleRingTest, GivenConcurrentWriterWhenReadingLatestSampleThenSamplesAreNeverTorn) {
+    constexpr uint64_t numSamples = 2000u;
+    std::thread writer([this]() {
+        auto writerSample = std::make_unique<SysmanSample>();
+        memset(writerSample.get(), 0, sizeof(SysmanSample));
+        writerSample->numEntries = SysmanSample::maxEntries;
+        for (uint64_t i = 1; i <= numSamples; i++) {
+            writerSample->timestamp = i;
+            for (auto &entry : writerSample->entries) {
+                entry.values[0] = i;
+            }
+            ring->publish(*writerSample);
+        }
+    });
+
+    auto readSample = std::make_unique<SysmanSample>();
+    uint64_t lastTimestamp = 0u;
+    while (lastTimestamp < numSamples) {
+        if (!ring->readLatest(*readSample)) {
+            continue;
+        }
+        EXPECT_GE(readSample->timestamp, lastTimestamp);
+        for (auto &entry : readSample->entries) {
+            EXPECT_EQ(readSample->timestamp, entry.values[0]);
+        }
+        lastTimestamp = readSample->timestamp;
+    }
+    writer.join();
+}
+
+} // namespace ult
+} // namespace L0
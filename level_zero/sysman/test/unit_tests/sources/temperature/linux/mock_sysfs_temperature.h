@@ -121,6 +121,21 @@ struct MockTemperaturePmt : public L0::Sysman::PlatformMonitoringTech {
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
     }
+
+    using L0::Sysman::PlatformMonitoringTech::readValues;
+    ze_result_t readValues(const std::vector<std::string> &keys, std::vector<uint32_t> &values) override {
+        readValuesCallCount++;
+        values.resize(keys.size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            auto result = readValue(keys[i], values[i]);
+            if (result != ZE_RESULT_SUCCESS) {
+                return result;
+            }
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    uint32_t readValuesCallCount = 0;
 };
 
 struct MockTemperatureFsAccess : public L0::Sysman::FsAccess {
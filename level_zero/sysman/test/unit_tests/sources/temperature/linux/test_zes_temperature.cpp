@@ -105,6 +105,22 @@ HWTEST2_F(SysmanMultiDeviceTemperatureFixture, GivenValidTempHandleWhenGettingTe
     }
 }
 
+HWTEST2_F(SysmanMultiDeviceTemperatureFixture, GivenMemoryTempHandleWhenGettingTemperatureThenAllHbmModulesAreReadWithSingleBatchedRead, IsPVC) {
+    auto handles = getTempHandles(handleComponentCountForTwoTileDevices);
+    for (auto handle : handles) {
+        zes_temp_properties_t properties = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zesTemperatureGetProperties(handle, &properties));
+        if (properties.type != ZES_TEMP_SENSORS_MEMORY) {
+            continue;
+        }
+        auto pPmt = static_cast<MockTemperaturePmt *>(pLinuxSysmanImp->getPlatformMonitoringTechAccess(properties.subdeviceId));
+        auto readValuesCallCount = pPmt->readValuesCallCount;
+        double temperature;
+        ASSERT_EQ(ZE_RESULT_SUCCESS, zesTemperatureGetState(handle, &temperature));
+        EXPECT_EQ(readValuesCallCount + 1, pPmt->readValuesCallCount);
+    }
+}
+
 TEST_F(SysmanMultiDeviceTemperatureFixture, GivenValidTempHandleWhenGettingTemperatureConfigThenUnsupportedIsReturned) {
     auto handles = getTempHandles(handleComponentCountForTwoTileDevices);
     for (auto handle : handles) {
@@ -21,6 +21,8 @@
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/include/zet_intel_gpu_debug.h"
 
+#include <thread>
+
 namespace L0 {
 
 DebugSession::DebugSession(const zet_debug_config_t &config, Device *device) : connectedDevice(device), config(config) {
@@ -400,6 +402,7 @@ DebugSessionImp::Error DebugSessionImp::resumeThreadsWithinDevice(uint32_t devic
     DEBUG_BREAK_IF(sipCommandResult != true);
 
     auto result = resumeImp(resumeThreadIds, deviceIndex);
+    invalidateStateSaveAreaSnapshots();
 
     // For resume(ALL) and multiple threads to resume - read whole state save area
     // to avoid multiple calls to KMD
@@ -428,6 +431,11 @@ DebugSessionImp::Error DebugSessionImp::resumeThreadsWithinDevice(uint32_t devic
             allThreads[threadID]->resumeThread();
         }
 
+        if (stateSaveAreaSnapshotEnabled && stateSaveReadResult == ZE_RESULT_SUCCESS) {
+            // read after resume, reused when checking which threads stopped again
+            storeStateSaveAreaSnapshot(memoryHandle, std::move(stateSaveArea), stateSaveAreaSize);
+        }
+
     } else {
 
         for (auto &threadID : resumeThreadIds) {
@@ -813,15 +821,14 @@ void DebugSessionImp::fillResumeAndStoppedThreadsFromNewlyStopped(std::vector<Eu
     if (newlyStoppedThreads.empty()) {
         return;
     }
-    const auto regSize = std::max(getRegisterSize(ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU), 64u);
-    auto reg = std::make_unique<uint32_t[]>(regSize / sizeof(uint32_t));
+    std::vector<uint8_t> forceExceptionOnly;
+    std::vector<uint32_t> exceptionBits;
+    classifyNewlyStoppedThreads(forceExceptionOnly, exceptionBits);
 
-    for (auto &newlyStopped : newlyStoppedThreads) {
+    for (size_t i = 0; i < newlyStoppedThreads.size(); i++) {
+        auto &newlyStopped = newlyStoppedThreads[i];
         if (allThreads[newlyStopped]->isStopped()) {
-            memset(reg.get(), 0, regSize);
-            readRegistersImp(newlyStopped, ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU, 0, 1, reg.get());
-
-            if (isForceExceptionOrForceExternalHaltOnlyExceptionReason(reg.get())) {
+            if (forceExceptionOnly[i]) {
                 bool threadWasInterrupted = false;
 
                 for (auto &request : pendingInterrupts) {
@@ -844,7 +851,7 @@ void DebugSessionImp::fillResumeAndStoppedThreadsFromNewlyStopped(std::vector<Eu
                     resumeThreads.push_back(newlyStopped);
                 }
             } else {
-                PRINT_DEBUGGER_THREAD_LOG("Newly stopped thread = %s, exception bits = %#010" PRIx32 "\n", allThreads[newlyStopped]->toString().c_str(), reg[1]);
+                PRINT_DEBUGGER_THREAD_LOG("Newly stopped thread = %s, exception bits = %#010" PRIx32 "\n", allThreads[newlyStopped]->toString().c_str(), exceptionBits[i]);
                 stoppedThreadsToReport.push_back(newlyStopped);
             }
         }
@@ -853,6 +860,80 @@ void DebugSessionImp::fillResumeAndStoppedThreadsFromNewlyStopped(std::vector<Eu
     newlyStoppedThreads.clear();
 }
 
+void DebugSessionImp::classifyNewlyStoppedThreads(std::vector<uint8_t> &forceExceptionOnly, std::vector<uint32_t> &exceptionBits) {
+    const auto threadCount = newlyStoppedThreads.size();
+    const auto regSize = std::max(getRegisterSize(ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU), 64u);
+    auto regdesc = typeToRegsetDesc(ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU);
+
+    forceExceptionOnly.assign(threadCount, 0);
+    exceptionBits.assign(threadCount, 0);
+
+    std::vector<EuThread *> threads(threadCount, nullptr);
+    std::unordered_map<uint64_t, StateSaveAreaSnapshot> snapshots;
+    bool readFromSnapshots = stateSaveAreaSnapshotEnabled && regdesc != nullptr;
+
+    for (size_t i = 0; i < threadCount; i++) {
+        auto thread = allThreads[newlyStoppedThreads[i]].get();
+        if (!thread->isStopped()) {
+            continue;
+        }
+        threads[i] = thread;
+
+        auto memoryHandle = thread->getMemoryHandle();
+        if (readFromSnapshots && snapshots.find(memoryHandle) == snapshots.end()) {
+            auto snapshot = getStateSaveAreaSnapshot(memoryHandle);
+            readFromSnapshots = snapshot.data != nullptr;
+            snapshots[memoryHandle] = std::move(snapshot);
+        }
+    }
+
+    auto classifyThreads = [&](size_t begin, size_t end) {
+        auto reg = std::make_unique<uint32_t[]>(regSize / sizeof(uint32_t));
+
+        for (size_t i = begin; i < end; i++) {
+            if (threads[i] == nullptr) {
+                continue;
+            }
+            memset(reg.get(), 0, regSize);
+
+            if (readFromSnapshots) {
+                const auto &snapshot = snapshots.find(threads[i]->getMemoryHandle())->second;
+                auto offset = calculateThreadSlotOffset(threads[i]->getThreadId()) + calculateRegisterOffsetInThreadSlot(regdesc, 0);
+                if (offset + regdesc->bytes <= snapshot.size) {
+                    memcpy_s(reg.get(), regSize, snapshot.data.get() + offset, regdesc->bytes);
+                }
+            } else {
+                readRegistersImp(newlyStoppedThreads[i], ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU, 0, 1, reg.get());
+            }
+
+            forceExceptionOnly[i] = isForceExceptionOrForceExternalHaltOnlyExceptionReason(reg.get());
+            exceptionBits[i] = reg[1];
+        }
+    };
+
+    // only reads served from snapshots are safe to be done concurrently
+    size_t workerCount = 1;
+    if (readFromSnapshots) {
+        workerCount = std::min(static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())), threadCount / minThreadsPerClassificationWorker);
+        workerCount = std::max(workerCount, static_cast<size_t>(1u));
+    }
+
+    const auto threadsPerWorker = (threadCount + workerCount - 1) / workerCount;
+    std::vector<std::thread> workers;
+    for (size_t worker = 1; worker < workerCount; worker++) {
+        auto begin = worker * threadsPerWorker;
+        auto end = std::min(threadCount, begin + threadsPerWorker);
+        if (begin < end) {
+            workers.emplace_back(classifyThreads, begin, end);
+        }
+    }
+    classifyThreads(0, std::min(threadCount, threadsPerWorker));
+
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
 void DebugSessionImp::generateEventsForPendingInterrupts() {
     zet_debug_event_t debugEvent = {};
 
@@ -896,6 +977,7 @@ void DebugSessionImp::resumeAccidentallyStoppedThreads(const std::vector<EuThrea
             [[maybe_unused]] auto writeSipCommandResult = writeResumeCommand(threadIdsPerDevice[i]);
             DEBUG_BREAK_IF(writeSipCommandResult != true);
             resumeImp(threadIdsPerDevice[i], i);
+            invalidateStateSaveAreaSnapshots();
         }
 
         for (auto &threadID : threadIdsPerDevice[i]) {
@@ -1252,6 +1334,12 @@ ze_result_t DebugSessionImp::registersAccessHelper(const EuThread *thread, const
     auto threadSlotOffset = calculateThreadSlotOffset(thread->getThreadId());
     auto startRegOffset = threadSlotOffset + calculateRegisterOffsetInThreadSlot(regdesc, start);
 
+    // CMD register is a mailbox updated by SIP, it is never served from snapshot
+    bool snapshotAccess = stateSaveAreaSnapshotEnabled && (regdesc != &getStateSaveAreaHeader()->regHeader.cmd);
+    if (snapshotAccess && !write && readRegistersFromSnapshot(thread, startRegOffset, count * regdesc->bytes, pRegisterValues)) {
+        return ZE_RESULT_SUCCESS;
+    }
+
     int ret = 0;
     if (write) {
         ret = writeGpuMemory(thread->getMemoryHandle(), static_cast<const char *>(pRegisterValues), count * regdesc->bytes, gpuVa + startRegOffset);
@@ -1259,9 +1347,118 @@ ze_result_t DebugSessionImp::registersAccessHelper(const EuThread *thread, const
         ret = readGpuMemory(thread->getMemoryHandle(), static_cast<char *>(pRegisterValues), count * regdesc->bytes, gpuVa + startRegOffset);
     }
 
+    if (ret == 0 && write && stateSaveAreaSnapshotEnabled) {
+        if (snapshotAccess) {
+            writeRegistersToSnapshot(thread, startRegOffset, count * regdesc->bytes, pRegisterValues);
+        } else {
+            // SIP commands may modify thread state, snapshot has to be taken again
+            invalidateStateSaveAreaSnapshots();
+        }
+    }
+
     return ret == 0 ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
 }
 
+ze_result_t DebugSessionImp::readStateSaveArea(uint64_t memoryHandle, char *output, size_t size, uint64_t gpuVa) {
+    for (size_t offset = 0; offset < size; offset += stateSaveAreaSnapshotChunkSize) {
+        auto chunkSize = std::min(stateSaveAreaSnapshotChunkSize, size - offset);
+        auto result = readGpuMemory(memoryHandle, output + offset, chunkSize, gpuVa + offset);
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+DebugSessionImp::StateSaveAreaSnapshot DebugSessionImp::captureStateSaveAreaSnapshot(uint64_t memoryHandle) {
+    StateSaveAreaSnapshot snapshot;
+
+    auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
+    auto stateSaveAreaSize = getContextStateSaveAreaSize(memoryHandle);
+    if (gpuVa == 0 || stateSaveAreaSize == 0) {
+        return snapshot;
+    }
+
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+        generation = stateSaveAreaSnapshotGeneration;
+    }
+
+    auto data = std::make_unique<char[]>(stateSaveAreaSize);
+    if (readStateSaveArea(memoryHandle, data.get(), stateSaveAreaSize, gpuVa) != ZE_RESULT_SUCCESS) {
+        PRINT_DEBUGGER_ERROR_LOG("Failed to snapshot state save area for memory handle %" PRIu64 "\n", memoryHandle);
+        return snapshot;
+    }
+    PRINT_DEBUGGER_INFO_LOG("State save area snapshot taken for memory handle %" PRIu64 ", size = %zu\n", memoryHandle, stateSaveAreaSize);
+
+    snapshot.data = std::shared_ptr<char[]>(std::move(data));
+    snapshot.size = stateSaveAreaSize;
+
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    // threads were resumed while reading, keep the data for the caller only
+    if (generation == stateSaveAreaSnapshotGeneration) {
+        stateSaveAreaSnapshots[memoryHandle] = snapshot;
+    }
+    return snapshot;
+}
+
+DebugSessionImp::StateSaveAreaSnapshot DebugSessionImp::getStateSaveAreaSnapshot(uint64_t memoryHandle) {
+    {
+        std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+        auto snapshot = stateSaveAreaSnapshots.find(memoryHandle);
+        if (snapshot != stateSaveAreaSnapshots.end()) {
+            return snapshot->second;
+        }
+    }
+    return captureStateSaveAreaSnapshot(memoryHandle);
+}
+
+void DebugSessionImp::storeStateSaveAreaSnapshot(uint64_t memoryHandle, std::unique_ptr<char[]> data, size_t size) {
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    auto &snapshot = stateSaveAreaSnapshots[memoryHandle];
+    snapshot.data = std::shared_ptr<char[]>(std::move(data));
+    snapshot.size = size;
+    // captures started before this store must not overwrite it
+    stateSaveAreaSnapshotGeneration++;
+}
+
+void DebugSessionImp::invalidateStateSaveAreaSnapshots() {
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    stateSaveAreaSnapshots.clear();
+    stateSaveAreaSnapshotGeneration++;
+}
+
+bool DebugSessionImp::readRegistersFromSnapshot(const EuThread *thread, size_t offset, size_t size, void *pRegisterValues) {
+    {
+        std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+        auto snapshot = stateSaveAreaSnapshots.find(thread->getMemoryHandle());
+        if (snapshot != stateSaveAreaSnapshots.end()) {
+            if (offset + size > snapshot->second.size) {
+                return false;
+            }
+            memcpy_s(pRegisterValues, size, snapshot->second.data.get() + offset, size);
+            return true;
+        }
+    }
+
+    auto snapshot = captureStateSaveAreaSnapshot(thread->getMemoryHandle());
+    if (!snapshot.data || offset + size > snapshot.size) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    memcpy_s(pRegisterValues, size, snapshot.data.get() + offset, size);
+    return true;
+}
+
+void DebugSessionImp::writeRegistersToSnapshot(const EuThread *thread, size_t offset, size_t size, const void *pRegisterValues) {
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    auto snapshot = stateSaveAreaSnapshots.find(thread->getMemoryHandle());
+    if (snapshot != stateSaveAreaSnapshots.end() && offset + size <= snapshot->second.size) {
+        memcpy_s(snapshot->second.data.get() + offset, snapshot->second.size - offset, pRegisterValues, size);
+    }
+}
+
 ze_result_t DebugSessionImp::cmdRegisterAccessHelper(const EuThread::ThreadId &threadId, SIP::sip_command &command, bool write) {
     auto stateSaveAreaHeader = getStateSaveAreaHeader();
     auto *regdesc = &stateSaveAreaHeader->regHeader.cmd;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "shared/source/built_ins/sip.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/string.h"
 
 #include "level_zero/tools/source/debug/debug_session.h"
@@ -17,8 +18,10 @@
 #include <atomic>
 #include <cmath>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace SIP {
@@ -40,6 +43,10 @@ struct DebugSessionImp : DebugSession {
 
     DebugSessionImp(const zet_debug_config_t &config, Device *device) : DebugSession(config, device) {
         tileAttachEnabled = NEO::DebugManager.flags.ExperimentalEnableTileAttach.get();
+        stateSaveAreaSnapshotEnabled = NEO::DebugManager.flags.EnableDebuggerStateSaveAreaSnapshot.get() == 1;
+        if (NEO::DebugManager.flags.DebuggerStateSaveAreaSnapshotChunkSize.get() > 0) {
+            stateSaveAreaSnapshotChunkSize = static_cast<size_t>(NEO::DebugManager.flags.DebuggerStateSaveAreaSnapshotChunkSize.get());
+        }
     }
 
     ze_result_t interrupt(ze_device_thread_t thread) override;
@@ -66,6 +73,7 @@ struct DebugSessionImp : DebugSession {
     static const SIP::regset_desc *getSbaRegsetDesc();
     static uint32_t typeToRegsetFlags(uint32_t type);
     constexpr static int64_t interruptTimeout = 2000;
+    constexpr static size_t defaultStateSaveAreaSnapshotChunkSize = 16 * MemoryConstants::megaByte;
 
     using ApiEventQueue = std::queue<zet_debug_event_t>;
 
@@ -108,6 +116,20 @@ struct DebugSessionImp : DebugSession {
     void validateAndSetStateSaveAreaHeader(uint64_t vmHandle, uint64_t gpuVa);
     virtual void readStateSaveAreaHeader(){};
 
+    struct StateSaveAreaSnapshot {
+        std::shared_ptr<char[]> data;
+        size_t size = 0;
+    };
+
+    ze_result_t readStateSaveArea(uint64_t memoryHandle, char *output, size_t size, uint64_t gpuVa);
+    StateSaveAreaSnapshot captureStateSaveAreaSnapshot(uint64_t memoryHandle);
+    StateSaveAreaSnapshot getStateSaveAreaSnapshot(uint64_t memoryHandle);
+    void storeStateSaveAreaSnapshot(uint64_t memoryHandle, std::unique_ptr<char[]> data, size_t size);
+    void invalidateStateSaveAreaSnapshots();
+    bool readRegistersFromSnapshot(const EuThread *thread, size_t offset, size_t size, void *pRegisterValues);
+    void writeRegistersToSnapshot(const EuThread *thread, size_t offset, size_t size, const void *pRegisterValues);
+    void classifyNewlyStoppedThreads(std::vector<uint8_t> &forceExceptionOnly, std::vector<uint32_t> &exceptionBits);
+
     virtual uint64_t getContextStateSaveAreaGpuVa(uint64_t memoryHandle) = 0;
     virtual size_t getContextStateSaveAreaSize(uint64_t memoryHandle) = 0;
 
@@ -158,6 +180,14 @@ struct DebugSessionImp : DebugSession {
     std::vector<std::pair<ze_device_thread_t, bool>> pendingInterrupts;
     std::vector<EuThread::ThreadId> newlyStoppedThreads;
     std::vector<char> stateSaveAreaHeader;
+
+    bool stateSaveAreaSnapshotEnabled = false;
+    size_t stateSaveAreaSnapshotChunkSize = defaultStateSaveAreaSnapshotChunkSize;
+    std::mutex stateSaveAreaSnapshotMutex;
+    std::unordered_map<uint64_t, StateSaveAreaSnapshot> stateSaveAreaSnapshots; // keyed by memory handle
+    uint64_t stateSaveAreaSnapshotGeneration = 0;
+    size_t minThreadsPerClassificationWorker = 512;
+
     SIP::version minSlmSipVersion = {2, 1, 0};
     bool sipSupportsSlm = false;
 
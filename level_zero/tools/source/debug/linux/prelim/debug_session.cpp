@@ -1337,6 +1337,11 @@ void DebugSessionLinux::handleAttentionEvent(prelim_drm_i915_debug_event_eu_atte
                     addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveArea.get());
                 }
             }
+
+            if (stateSaveAreaSnapshotEnabled) {
+                DebugSessionLinux *session = tileSessionsEnabled ? static_cast<TileDebugSessionLinux *>(tileSessions[tileIndex].first) : this;
+                session->storeStateSaveAreaSnapshot(vmHandle, std::move(stateSaveArea), stateSaveAreaSize);
+            }
         }
     }
 
@@ -1520,11 +1525,18 @@ void DebugSessionLinux::checkStoppedThreadsAndGenerateEvents(const std::vector<E
     const auto &threadsToCheck = threadsWithAttention.size() > 0 ? threadsWithAttention : threads;
     stoppedThreadsToReport.reserve(threadsToCheck.size());
 
+    StateSaveAreaSnapshot snapshot;
+    if (stateSaveAreaSnapshotEnabled && threadsToCheck.size() > 1) {
+        snapshot = getStateSaveAreaSnapshot(memoryHandle);
+    }
+
     for (auto &threadId : threadsToCheck) {
         SIP::sr_ident srMagic = {{0}};
         srMagic.count = 0;
 
-        if (readSystemRoutineIdent(allThreads[threadId].get(), memoryHandle, srMagic)) {
+        bool srIdentRead = snapshot.data ? readSystemRoutineIdentFromMemory(allThreads[threadId].get(), snapshot.data.get(), srMagic)
+                                         : readSystemRoutineIdent(allThreads[threadId].get(), memoryHandle, srMagic);
+        if (srIdentRead) {
             bool wasStopped = allThreads[threadId]->isStopped();
 
             if (allThreads[threadId]->verifyStopped(srMagic.count)) {
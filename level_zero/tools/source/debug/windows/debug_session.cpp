@@ -285,6 +285,10 @@ ze_result_t DebugSessionWindows::handleEuAttentionBitsEvent(DBGUMD_READ_EVENT_EU
                 PRINT_DEBUGGER_THREAD_LOG("ATTENTION event for thread: %s\n", EuThread::toString(threadId).c_str());
                 addThreadToNewlyStoppedFromRaisedAttention(threadId, memoryHandle, stateSaveArea.get());
             }
+
+            if (stateSaveAreaSnapshotEnabled) {
+                storeStateSaveAreaSnapshot(memoryHandle, std::move(stateSaveArea), stateSaveAreaSize);
+            }
         }
     }
 
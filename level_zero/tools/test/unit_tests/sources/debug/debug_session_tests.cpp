@@ -980,6 +980,47 @@ TEST(DebugSessionTest, givenMultipleStoppedThreadsWhenResumeAllCalledThenStateSa
     EXPECT_EQ(threadCount, sessionMock->checkThreadIsResumedCalled);
 }
 
+TEST(DebugSessionTest, givenStateSaveAreaSnapshotEnabledWhenResumeAllCalledForMultipleThreadsThenStateSaveAreaReadAfterResumeIsReusedAsSnapshot) {
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    auto hwInfo = *NEO::defaultHwInfo.get();
+    hwInfo.gtSystemInfo.EUCount = 8;
+    hwInfo.gtSystemInfo.ThreadCount = 8 * hwInfo.gtSystemInfo.EUCount;
+
+    NEO::MockDevice *neoDevice(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    Mock<L0::DeviceImp> deviceImp(neoDevice, neoDevice->getExecutionEnvironment());
+
+    auto sessionMock = std::make_unique<MockDebugSession>(config, &deviceImp);
+    sessionMock->stateSaveAreaSnapshotEnabled = true;
+
+    {
+        auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(sessionMock->stateSaveAreaHeader.data());
+        auto size = pStateSaveAreaHeader->versionHeader.size * 8 +
+                    pStateSaveAreaHeader->regHeader.state_area_offset +
+                    pStateSaveAreaHeader->regHeader.state_save_size * 16;
+        sessionMock->stateSaveAreaHeader.resize(size);
+    }
+
+    auto threadCount = hwInfo.gtSystemInfo.ThreadCount / hwInfo.gtSystemInfo.EUCount;
+    EuThread::ThreadId thread(0, 0, 0, 0, 0);
+    for (uint32_t i = 0; i < threadCount; i++) {
+        EuThread::ThreadId stoppedThread(0, 0, 0, 0, i);
+        sessionMock->allThreads[stoppedThread]->stopThread(1u);
+        sessionMock->allThreads[stoppedThread]->reportAsStopped();
+    }
+    auto memoryHandle = sessionMock->allThreads[thread]->getMemoryHandle();
+
+    ze_device_thread_t threadAll = {UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sessionMock->resume(threadAll));
+    EXPECT_EQ(1u, sessionMock->stateSaveAreaSnapshots.size());
+
+    auto readGpuMemoryCallCount = sessionMock->readGpuMemoryCallCount;
+    auto snapshot = sessionMock->getStateSaveAreaSnapshot(memoryHandle);
+    EXPECT_NE(nullptr, snapshot.data.get());
+    EXPECT_EQ(sessionMock->getContextStateSaveAreaSize(memoryHandle), snapshot.size);
+    EXPECT_EQ(readGpuMemoryCallCount, sessionMock->readGpuMemoryCallCount);
+}
+
 TEST(DebugSessionTest, givenMultipleStoppedThreadsWhenResumeAllCalledThenStateSaveAreaIsReadUntilThreadsConfirmedToBeResumed) {
 
     class InternalMockDebugSession : public MockDebugSession {
@@ -2752,6 +2793,214 @@ TEST_F(DebugSessionRegistersAccessTest, GivenBindlessSipWhenCheckingDifferentSip
     EXPECT_EQ(session->sipSupportsSlm, true);
 }
 
+TEST_F(DebugSessionRegistersAccessTest, GivenStateSaveAreaSnapshotEnabledWhenReadingRegistersOfStoppedThreadThenStateSaveAreaIsReadOnce) {
+    session->stateSaveAreaSnapshotEnabled = true;
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+
+    auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data());
+    auto grfOffset = session->calculateThreadSlotOffset(stoppedThreadId) + pStateSaveAreaHeader->regHeader.grf.offset;
+    uint32_t grf[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    memcpy_s(session->stateSaveAreaHeader.data() + grfOffset, sizeof(grf), grf, sizeof(grf));
+
+    session->readGpuMemoryCallCount = 0;
+    uint32_t output[8] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, output));
+    EXPECT_EQ(0, memcmp(grf, output, sizeof(grf)));
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+
+    for (uint32_t i = 1; i < 4; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, i, 1, output));
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU, 0, 1, output));
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+    EXPECT_EQ(1u, session->stateSaveAreaSnapshots.size());
+}
+
+TEST_F(DebugSessionRegistersAccessTest, GivenStateSaveAreaSnapshotWhenWritingRegistersThenGpuMemoryAndSnapshotAreUpdated) {
+    session->stateSaveAreaSnapshotEnabled = true;
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+
+    auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data());
+    auto grfOffset = session->calculateThreadSlotOffset(stoppedThreadId) + pStateSaveAreaHeader->regHeader.grf.offset;
+
+    uint32_t output[8] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, output));
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+
+    uint32_t grf[8] = {8, 7, 6, 5, 4, 3, 2, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->writeRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf));
+    EXPECT_EQ(0, memcmp(grf, session->stateSaveAreaHeader.data() + grfOffset, sizeof(grf)));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, output));
+    EXPECT_EQ(0, memcmp(grf, output, sizeof(grf)));
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+}
+
+TEST_F(DebugSessionRegistersAccessTest, GivenStateSaveAreaSnapshotWhenThreadIsResumedThenSnapshotIsInvalidated) {
+    session->stateSaveAreaSnapshotEnabled = true;
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+
+    auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data());
+    auto grfOffset = session->calculateThreadSlotOffset(stoppedThreadId) + pStateSaveAreaHeader->regHeader.grf.offset;
+
+    uint32_t output[8] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, output));
+    EXPECT_EQ(1u, session->stateSaveAreaSnapshots.size());
+
+    uint32_t grf[8] = {9, 9, 9, 9, 9, 9, 9, 9};
+    memcpy_s(session->stateSaveAreaHeader.data() + grfOffset, sizeof(grf), grf, sizeof(grf));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->resume(stoppedThread));
+    EXPECT_EQ(0u, session->stateSaveAreaSnapshots.size());
+
+    session->allThreads[stoppedThreadId]->stopThread(1u);
+    session->allThreads[stoppedThreadId]->reportAsStopped();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, output));
+    EXPECT_EQ(0, memcmp(grf, output, sizeof(grf)));
+    EXPECT_EQ(2u, session->readGpuMemoryCallCount);
+}
+
+TEST_F(DebugSessionRegistersAccessTest, GivenStateSaveAreaSnapshotWhenAccessingCmdRegisterThenGpuMemoryIsAccessedAndSnapshotInvalidatedOnWrite) {
+    session->stateSaveAreaSnapshotEnabled = true;
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+
+    uint32_t output[8] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, output));
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+
+    auto *regdesc = &(reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data()))->regHeader.cmd;
+    SIP::sip_command command = {0};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(session->allThreads[stoppedThreadId].get(), regdesc, 0, 1, &command, false));
+    EXPECT_EQ(2u, session->readGpuMemoryCallCount);
+    EXPECT_EQ(1u, session->stateSaveAreaSnapshots.size());
+
+    command.command = static_cast<uint32_t>(NEO::SipKernel::COMMAND::RESUME);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(session->allThreads[stoppedThreadId].get(), regdesc, 0, 1, &command, true));
+    EXPECT_EQ(0u, session->stateSaveAreaSnapshots.size());
+}
+
+TEST_F(DebugSessionRegistersAccessTest, GivenStateSaveAreaSnapshotEnabledWhenClassifyingNewlyStoppedThreadsThenCrRegistersAreReadFromSnapshot) {
+    session->stateSaveAreaSnapshotEnabled = true;
+    session->minThreadsPerClassificationWorker = 2;
+    session->callBaseIsForceExceptionOrForceExternalHaltOnlyExceptionReason = true;
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+
+    auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data());
+    std::vector<EuThread::ThreadId> expectedStoppedThreads;
+    std::vector<EuThread::ThreadId> expectedResumedThreads;
+
+    for (uint32_t eu = 0; eu < 4; eu++) {
+        for (uint32_t thread = 0; thread < pStateSaveAreaHeader->regHeader.num_threads_per_eu; thread++) {
+            EuThread::ThreadId threadId(0, 0, 0, eu, thread);
+            session->allThreads[threadId]->stopThread(1u);
+            session->newlyStoppedThreads.push_back(threadId);
+
+            uint32_t cr0[4] = {};
+            if (thread % 2) {
+                cr0[1] = 1 << 26;
+                expectedResumedThreads.push_back(threadId);
+            } else {
+                cr0[1] = 1 << 15 | 1 << 31;
+                expectedStoppedThreads.push_back(threadId);
+            }
+            auto crOffset = session->calculateThreadSlotOffset(threadId) + pStateSaveAreaHeader->regHeader.cr.offset;
+            memcpy_s(session->stateSaveAreaHeader.data() + crOffset, sizeof(cr0), cr0, sizeof(cr0));
+        }
+    }
+
+    std::vector<EuThread::ThreadId> resumeThreads;
+    std::vector<EuThread::ThreadId> stoppedThreadsToReport;
+    std::vector<EuThread::ThreadId> interruptedThreads;
+    session->fillResumeAndStoppedThreadsFromNewlyStopped(resumeThreads, stoppedThreadsToReport, interruptedThreads);
+
+    EXPECT_EQ(0u, session->readRegistersCallCount);
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+    EXPECT_TRUE(session->newlyStoppedThreads.empty());
+    EXPECT_TRUE(interruptedThreads.empty());
+    ASSERT_EQ(expectedStoppedThreads.size(), stoppedThreadsToReport.size());
+    ASSERT_EQ(expectedResumedThreads.size(), resumeThreads.size());
+    for (size_t i = 0; i < expectedStoppedThreads.size(); i++) {
+        EXPECT_EQ(expectedStoppedThreads[i].packed, stoppedThreadsToReport[i].packed);
+    }
+    for (size_t i = 0; i < expectedResumedThreads.size(); i++) {
+        EXPECT_EQ(expectedResumedThreads[i].packed, resumeThreads[i].packed);
+    }
+}
+
+TEST(DebugSessionTest, GivenStateSaveAreaSnapshotFlagsWhenSnapshotIsTakenThenStateSaveAreaIsReadInChunks) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableDebuggerStateSaveAreaSnapshot.set(1);
+    NEO::DebugManager.flags.DebuggerStateSaveAreaSnapshotChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    auto hwInfo = *NEO::defaultHwInfo.get();
+
+    NEO::MockDevice *neoDevice(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    Mock<L0::DeviceImp> deviceImp(neoDevice, neoDevice->getExecutionEnvironment());
+
+    auto sessionMock = std::make_unique<MockDebugSession>(config, &deviceImp);
+    EXPECT_TRUE(sessionMock->stateSaveAreaSnapshotEnabled);
+
+    auto stateSaveAreaSize = sessionMock->getContextStateSaveAreaSize(0);
+    sessionMock->stateSaveAreaHeader.resize(stateSaveAreaSize);
+
+    ze_device_thread_t thread = {0, 0, 0, 0};
+    EuThread::ThreadId threadId(0, thread);
+    sessionMock->allThreads[threadId]->stopThread(1u);
+    sessionMock->allThreads[threadId]->reportAsStopped();
+
+    uint32_t output[8] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sessionMock->readRegisters(thread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, output));
+    EXPECT_EQ(stateSaveAreaSize / MemoryConstants::pageSize, sessionMock->readGpuMemoryCallCount);
+}
+
+TEST(DebugSessionTest, GivenSnapshotStoredWhileStateSaveAreaIsBeingCapturedWhenCaptureCompletesThenStoredSnapshotIsKept) {
+    struct MockDebugSessionStoringDuringRead : public MockDebugSession {
+        using MockDebugSession::MockDebugSession;
+
+        ze_result_t readGpuMemory(uint64_t memoryHandle, char *output, size_t size, uint64_t gpuVa) override {
+            if (storedData) {
+                storeStateSaveAreaSnapshot(memoryHandle, std::move(storedData), storedSize);
+            }
+            return MockDebugSession::readGpuMemory(memoryHandle, output, size, gpuVa);
+        }
+
+        std::unique_ptr<char[]> storedData;
+        size_t storedSize = 0;
+    };
+
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableDebuggerStateSaveAreaSnapshot.set(1);
+
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    auto hwInfo = *NEO::defaultHwInfo.get();
+
+    NEO::MockDevice *neoDevice(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    Mock<L0::DeviceImp> deviceImp(neoDevice, neoDevice->getExecutionEnvironment());
+
+    auto sessionMock = std::make_unique<MockDebugSessionStoringDuringRead>(config, &deviceImp);
+    sessionMock->stateSaveAreaHeader.resize(sessionMock->getContextStateSaveAreaSize(0));
+    sessionMock->storedSize = sessionMock->stateSaveAreaHeader.size();
+    sessionMock->storedData = std::make_unique<char[]>(sessionMock->storedSize);
+    auto storedDataPtr = sessionMock->storedData.get();
+
+    ze_device_thread_t thread = {0, 0, 0, 0};
+    EuThread::ThreadId threadId(0, thread);
+    sessionMock->allThreads[threadId]->stopThread(1u);
+    sessionMock->allThreads[threadId]->reportAsStopped();
+
+    auto generation = sessionMock->stateSaveAreaSnapshotGeneration;
+    uint32_t output[8] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sessionMock->readRegisters(thread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, output));
+
+    EXPECT_EQ(generation + 1, sessionMock->stateSaveAreaSnapshotGeneration);
+    ASSERT_EQ(1u, sessionMock->stateSaveAreaSnapshots.size());
+    EXPECT_EQ(storedDataPtr, sessionMock->stateSaveAreaSnapshots.begin()->second.data.get());
+}
+
 TEST(DebugSessionTest, GivenStoppedThreadWhenValidAddressesSizesAndOffsetsThenSlmReadIsSuccessful) {
 
     zet_debug_config_t config = {};
@@ -5937,6 +5937,100 @@ TEST_F(DebugApiLinuxAttentionTest, GivenEuAttentionEventForThreadsWhenHandlingEv
     EXPECT_EQ(threads.size(), sessionMock->newlyStoppedThreads.size());
 }
 
+TEST_F(DebugApiLinuxAttentionTest, GivenStateSaveAreaSnapshotEnabledWhenReadingRegistersOfThreadsStoppedByAttentionThenNoAdditionalGpuMemoryReadsAreIssued) {
+    DebugManagerStateRestore restorer;
+
+    uint64_t ctxHandle = 2;
+    uint64_t vmHandle = 7;
+    uint64_t lrcHandle = 8;
+
+    std::vector<EuThread::ThreadId> threads{
+        {0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 1},
+        {0, 0, 0, 0, 2},
+        {0, 0, 0, 0, 3},
+        {0, 0, 0, 0, 4},
+        {0, 0, 0, 0, 5},
+        {0, 0, 0, 0, 6}};
+
+    int64_t gpuMemoryReads[2] = {};
+    int ioctlCalls[2] = {};
+
+    for (int32_t snapshotEnabled = 0; snapshotEnabled < 2; snapshotEnabled++) {
+        DebugManager.flags.EnableDebuggerStateSaveAreaSnapshot.set(snapshotEnabled);
+
+        zet_debug_config_t config = {};
+        config.pid = 0x1234;
+
+        auto sessionMock = std::make_unique<MockDebugSessionLinux>(config, device, 10);
+        ASSERT_NE(nullptr, sessionMock);
+        sessionMock->clientHandle = MockDebugSessionLinux::mockClientHandle;
+
+        auto handler = new MockIoctlHandler;
+        sessionMock->ioctlHandler.reset(handler);
+        SIP::version version = {2, 0, 0};
+        initStateSaveArea(sessionMock->stateSaveAreaHeader, version, device);
+        handler->setPreadMemory(sessionMock->stateSaveAreaHeader.data(), sessionMock->stateSaveAreaHeader.size(), 0x1000);
+        handler->mmapRet = sessionMock->stateSaveAreaHeader.data();
+        handler->mmapBase = 0x1000;
+
+        sessionMock->clientHandleToConnection[MockDebugSessionLinux::mockClientHandle]->contextsCreated[ctxHandle].vm = vmHandle;
+        sessionMock->clientHandleToConnection[MockDebugSessionLinux::mockClientHandle]->lrcToContextHandle[lrcHandle] = ctxHandle;
+
+        DebugSessionLinux::BindInfo cssaInfo = {0x1000, sessionMock->stateSaveAreaHeader.size()};
+        sessionMock->clientHandleToConnection[MockDebugSessionLinux::mockClientHandle]->vmToContextStateSaveAreaBindInfo[vmHandle] = cssaInfo;
+
+        uint8_t data[sizeof(prelim_drm_i915_debug_event_eu_attention) + 128];
+        std::unique_ptr<uint8_t[]> bitmask;
+        size_t bitmaskSize = 0;
+        auto &hwInfo = neoDevice->getHardwareInfo();
+        auto &l0GfxCoreHelper = neoDevice->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
+
+        for (auto thread : threads) {
+            sessionMock->stoppedThreads[thread.packed] = 1;
+        }
+
+        l0GfxCoreHelper.getAttentionBitmaskForSingleThreads(threads, hwInfo, bitmask, bitmaskSize);
+
+        prelim_drm_i915_debug_event_eu_attention attention = {};
+        attention.base.type = PRELIM_DRM_I915_DEBUG_EVENT_EU_ATTENTION;
+        attention.base.flags = PRELIM_DRM_I915_DEBUG_EVENT_STATE_CHANGE;
+        attention.base.size = sizeof(prelim_drm_i915_debug_event_eu_attention) + std::min(uint32_t(128), static_cast<uint32_t>(bitmaskSize));
+        attention.client_handle = MockDebugSessionLinux::mockClientHandle;
+        attention.lrc_handle = lrcHandle;
+        attention.flags = 0;
+        attention.ci.engine_class = 0;
+        attention.ci.engine_instance = 0;
+        attention.bitmask_size = std::min(uint32_t(128), static_cast<uint32_t>(bitmaskSize));
+
+        memcpy(data, &attention, sizeof(prelim_drm_i915_debug_event_eu_attention));
+        memcpy(ptrOffset(data, offsetof(prelim_drm_i915_debug_event_eu_attention, bitmask)), bitmask.get(), std::min(size_t(128), bitmaskSize));
+
+        sessionMock->handleEvent(reinterpret_cast<prelim_drm_i915_debug_event *>(data));
+        ASSERT_EQ(threads.size(), sessionMock->newlyStoppedThreads.size());
+
+        auto preadCalledAfterAttention = handler->preadCalled + handler->mmapCalled;
+        auto ioctlCalledAfterAttention = handler->ioctlCalled;
+
+        uint32_t cr0[8] = {};
+        uint32_t grf[8] = {};
+        for (auto &thread : threads) {
+            sessionMock->allThreads[thread]->reportAsStopped();
+            ze_device_thread_t apiThread = {0, 0, 0, static_cast<uint32_t>(thread.thread)};
+            EXPECT_EQ(ZE_RESULT_SUCCESS, sessionMock->readRegisters(apiThread, ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU, 0, 1, cr0));
+            EXPECT_EQ(ZE_RESULT_SUCCESS, sessionMock->readRegisters(apiThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf));
+        }
+
+        gpuMemoryReads[snapshotEnabled] = handler->preadCalled + handler->mmapCalled - preadCalledAfterAttention;
+        ioctlCalls[snapshotEnabled] = handler->ioctlCalled - ioctlCalledAfterAttention;
+    }
+
+    EXPECT_EQ(static_cast<int64_t>(2 * threads.size()), gpuMemoryReads[0]);
+    EXPECT_EQ(static_cast<int>(2 * threads.size()), ioctlCalls[0]);
+    EXPECT_EQ(0, gpuMemoryReads[1]);
+    EXPECT_EQ(0, ioctlCalls[1]);
+}
+
 TEST_F(DebugApiLinuxAttentionTest, GivenEuAttentionEventWithInvalidClientWhenHandlingEventThenNoStoppedThreadsSet) {
     zet_debug_config_t config = {};
     config.pid = 0x1234;
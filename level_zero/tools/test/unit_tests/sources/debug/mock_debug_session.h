@@ -151,6 +151,7 @@ struct MockDebugSession : public L0::DebugSessionImp {
     using L0::DebugSessionImp::generateEventsForStoppedThreads;
     using L0::DebugSessionImp::getRegisterSize;
     using L0::DebugSessionImp::getStateSaveAreaHeader;
+    using L0::DebugSessionImp::getStateSaveAreaSnapshot;
     using L0::DebugSessionImp::newAttentionRaised;
     using L0::DebugSessionImp::readSbaRegisters;
     using L0::DebugSessionImp::registersAccessHelper;
@@ -161,6 +162,9 @@ struct MockDebugSession : public L0::DebugSessionImp {
 
     using L0::DebugSessionImp::interruptSent;
     using L0::DebugSessionImp::stateSaveAreaHeader;
+    using L0::DebugSessionImp::stateSaveAreaSnapshotEnabled;
+    using L0::DebugSessionImp::stateSaveAreaSnapshotGeneration;
+    using L0::DebugSessionImp::stateSaveAreaSnapshots;
     using L0::DebugSessionImp::triggerEvents;
 
     using L0::DebugSessionImp::expectedAttentionEvents;
@@ -168,6 +172,7 @@ struct MockDebugSession : public L0::DebugSessionImp {
     using L0::DebugSessionImp::interruptRequests;
     using L0::DebugSessionImp::isValidGpuAddress;
     using L0::DebugSessionImp::minSlmSipVersion;
+    using L0::DebugSessionImp::minThreadsPerClassificationWorker;
     using L0::DebugSessionImp::newlyStoppedThreads;
     using L0::DebugSessionImp::pendingInterrupts;
     using L0::DebugSessionImp::readStateSaveAreaHeader;
@@ -276,6 +281,7 @@ struct MockDebugSession : public L0::DebugSessionImp {
     }
 
     ze_result_t readGpuMemory(uint64_t memoryHandle, char *output, size_t size, uint64_t gpuVa) override {
+        readGpuMemoryCallCount++;
         if (gpuVa != 0 && gpuVa >= reinterpret_cast<uint64_t>(stateSaveAreaHeader.data()) &&
             ((gpuVa + size) <= reinterpret_cast<uint64_t>(stateSaveAreaHeader.data() + stateSaveAreaHeader.size()))) {
             [[maybe_unused]] auto offset = ptrDiff(gpuVa, reinterpret_cast<uint64_t>(stateSaveAreaHeader.data()));
@@ -490,6 +496,7 @@ struct MockDebugSession : public L0::DebugSessionImp {
 
     uint32_t readStateSaveAreaHeaderCalled = 0;
     uint32_t readRegistersCallCount = 0;
+    uint32_t readGpuMemoryCallCount = 0;
     uint32_t readRegistersReg = 0;
     uint32_t writeRegistersCallCount = 0;
     uint32_t writeRegistersReg = 0;
@@ -9,6 +9,7 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
+#include "shared/source/helpers/blit_helper.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/flat_batch_buffer_helper.h"
 #include "shared/source/helpers/flush_stamp.h"
@@ -1298,8 +1299,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueBlitSplit(MultiDispatchInfo &dispatchIn
     auto size = dispatchInfo.peekBuiltinOpParams().size.x;
     auto remainingSize = size;
 
-    for (size_t i = 0; i < copyEngines.size(); i++) {
-        auto localSize = remainingSize / (copyEngines.size() - i);
+    for (size_t i = 0; i < copyEngines.size() && remainingSize > 0; i++) {
+        auto localSize = BlitHelper::getBcsSplitSubcopySize(remainingSize, copyEngines.size() - i);
         auto localParams = dispatchInfo.peekBuiltinOpParams();
         localParams.size.x = localSize;
         localParams.srcOffset.x = (srcOffset + size - remainingSize);
@@ -17,8 +17,10 @@
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/mt_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/utilities/chrome_trace_logger.h"
 #include "shared/source/utilities/perf_counter.h"
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/tag_allocator.h"
@@ -29,6 +31,7 @@
 #include "opencl/source/context/context.h"
 #include "opencl/source/event/async_events_handler.h"
 #include "opencl/source/event/event_tracker.h"
+#include "opencl/source/helpers/cl_helper.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/helpers/task_information.h"
@@ -410,6 +413,35 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     }
 
     dataCalculated = true;
+
+    logProfilingData(getChromeTraceLogger());
+}
+
+ChromeTraceLogger &Event::getChromeTraceLogger() {
+    return chromeTraceLoggerInstance();
+}
+
+void Event::logProfilingData(ChromeTraceLogger &chromeTraceLogger) {
+    if (!chromeTraceLogger.enabled() || DebugManager.flags.ReturnRawGpuTimestamps.get()) {
+        return;
+    }
+
+    auto queueTrackId = castToUint64(this->cmdQueue);
+    auto commandName = cmdTypetoString(this->cmdType);
+
+    // both spans are emitted in CPU time, device based timestamps are moved
+    // to the CPU domain with the queue CPU/GPU timestamp pair
+    int64_t gpuToCpuOffset = 0;
+    if (DebugManager.flags.EnableDeviceBasedTimestamps.get() && !isCPUProfilingPath()) {
+        auto &device = cmdQueue->getDevice();
+        double resolution = device.getDeviceInfo().profilingTimerResolution;
+        gpuToCpuOffset = queueTimeStamp.cpuTimeinNS - device.getGfxCoreHelper().getGpuTimeStampInNS(queueTimeStamp.gpuTimeStamp, resolution);
+    }
+
+    chromeTraceLogger.logSpan(commandName + " queued", ChromeTraceLogger::Track::Host, queueTrackId,
+                              queueTimeStamp.cpuTimeinNS, submitTimeStamp.cpuTimeinNS);
+    chromeTraceLogger.logSpan(commandName, ChromeTraceLogger::Track::Gpu, queueTrackId,
+                              startTimeStamp + gpuToCpuOffset, endTimeStamp + gpuToCpuOffset);
 }
 
 void Event::getBoundaryTimestampValues(TimestampPacketContainer *timestampContainer, uint64_t &globalStartTS, uint64_t &globalEndTS) {
@@ -485,6 +517,10 @@ void Event::updateExecutionStatus() {
 
     if ((cmdQueue != nullptr) && this->isCompleted()) {
         transitionExecutionStatus(CL_COMPLETE);
+        if (this->isProfilingEnabled() && getChromeTraceLogger().enabled()) {
+            // export every profiled event, not only the ones the application queries
+            calcProfilingData();
+        }
         executeCallbacks(CL_COMPLETE);
         unblockEventsBlockedByThis(CL_COMPLETE);
         auto *allocationStorage = cmdQueue->getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
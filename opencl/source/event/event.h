@@ -29,6 +29,7 @@ class CommandQueue;
 class Context;
 class Device;
 class TimestampPacketContainer;
+class ChromeTraceLogger;
 enum class WaitStatus;
 
 template <>
@@ -337,6 +338,8 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     uint64_t getTimeInNSFromTimestampData(const TimeStampData &timestamp) const;
     bool calcProfilingData();
     MOCKABLE_VIRTUAL void calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t contextEndTS, uint64_t *contextCompleteTS, uint64_t globalStartTS);
+    void logProfilingData(ChromeTraceLogger &chromeTraceLogger);
+    MOCKABLE_VIRTUAL ChromeTraceLogger &getChromeTraceLogger();
     MOCKABLE_VIRTUAL void synchronizeTaskCount() {
         while (this->taskCount == CompletionStamp::notReady)
             ;
@@ -22,6 +22,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -56,6 +57,7 @@
 #include "opencl/source/helpers/sampler_helpers.h"
 #include "opencl/source/kernel/image_transformer.h"
 #include "opencl/source/kernel/kernel_info_cl.h"
+#include "opencl/source/kernel/kernel_tuning_database.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/source/mem_obj/pipe.h"
@@ -67,6 +69,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <sstream>
 #include <vector>
 
 using namespace iOpenCL;
@@ -1199,6 +1202,17 @@ void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, c
 
         auto submissionDataIt = this->kernelSubmissionMap.find(config);
         if (submissionDataIt == this->kernelSubmissionMap.end()) {
+            bool singleSubdevicePreferred = false;
+            if (getKernelTuningDatabase().isEnabled() &&
+                getKernelTuningDatabase().find(getKernelTuningKey(config), singleSubdevicePreferred)) {
+                KernelSubmissionData submissionData;
+                submissionData.status = TunningStatus::TUNNING_DONE;
+                submissionData.singleSubdevicePreferred = singleSubdevicePreferred;
+                this->kernelSubmissionMap[config] = std::move(submissionData);
+                this->singleSubdevicePreferredInCurrentEnqueue = singleSubdevicePreferred;
+                return;
+            }
+
             KernelSubmissionData submissionData;
             submissionData.kernelStandardTimestamps = std::make_unique<TimestampPacketContainer>();
             submissionData.kernelSubdeviceTimestamps = std::make_unique<TimestampPacketContainer>();
@@ -1221,6 +1235,9 @@ void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, c
                 submissionData.kernelStandardTimestamps.reset();
                 submissionData.kernelSubdeviceTimestamps.reset();
                 this->singleSubdevicePreferredInCurrentEnqueue = submissionData.singleSubdevicePreferred;
+                if (getKernelTuningDatabase().isEnabled()) {
+                    getKernelTuningDatabase().store(getKernelTuningKey(config), submissionData.singleSubdevicePreferred);
+                }
             } else {
                 this->singleSubdevicePreferredInCurrentEnqueue = false;
             }
@@ -1234,6 +1251,26 @@ void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, c
     }
 }
 
+KernelTuningDatabase &Kernel::getKernelTuningDatabase() {
+    if (this->kernelTuningDatabase == nullptr) {
+        this->kernelTuningDatabase = &kernelTuningDatabaseInstance();
+    }
+    return *this->kernelTuningDatabase;
+}
+
+std::string Kernel::getKernelTuningKey(const KernelConfig &config) const {
+    auto &hwInfo = getHardwareInfo();
+    std::ostringstream key;
+    key << kernelInfo.kernelDescriptor.kernelMetadata.kernelName
+        << "_" << std::hex << Hash::hash(reinterpret_cast<const char *>(kernelInfo.heapInfo.pKernelHeap), kernelInfo.heapInfo.kernelHeapSize)
+        << "_" << hwInfo.platform.usDeviceID << "_" << hwInfo.platform.usRevId << std::dec
+        << "_" << clDevice.getNumGenericSubDevices();
+    for (const auto &dimensions : {config.gws, config.lws, config.offsets}) {
+        key << "_" << dimensions.x << "x" << dimensions.y << "x" << dimensions.z;
+    }
+    return key.str();
+}
+
 bool Kernel::hasTunningFinished(KernelSubmissionData &submissionData) {
     if (!this->hasRunFinished(submissionData.kernelStandardTimestamps.get()) ||
         !this->hasRunFinished(submissionData.kernelSubdeviceTimestamps.get())) {
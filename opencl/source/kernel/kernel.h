@@ -42,6 +42,7 @@ class Surface;
 class PrintfHandler;
 class MultiDeviceKernel;
 class LocalIdsCache;
+class KernelTuningDatabase;
 
 class Kernel : public ReferenceTrackedObject<Kernel> {
   public:
@@ -474,6 +475,8 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     bool hasTunningFinished(KernelSubmissionData &submissionData);
     bool hasRunFinished(TimestampPacketContainer *timestampContainer);
+    KernelTuningDatabase &getKernelTuningDatabase();
+    std::string getKernelTuningKey(const KernelConfig &config) const;
 
     void initializeLocalIdsCache();
     std::unique_ptr<LocalIdsCache> localIdsCache;
@@ -483,6 +486,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     std::map<uint32_t, MemObj *> migratableArgsMap{};
 
     std::unordered_map<KernelConfig, KernelSubmissionData, KernelConfigHash> kernelSubmissionMap;
+    KernelTuningDatabase *kernelTuningDatabase = nullptr;
 
     std::vector<SimpleKernelArgInfo> kernelArguments;
     std::vector<KernelArgHandler> kernelArgHandlers;
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/kernel/kernel_tuning_database.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include <cstdio>
+#include <sstream>
+
+namespace NEO {
+
+KernelTuningDatabase &kernelTuningDatabaseInstance() {
+    static KernelTuningDatabase kernelTuningDatabaseInstance(DebugManager.flags.KernelTunningDatabaseFile.get());
+    return kernelTuningDatabaseInstance;
+}
+
+KernelTuningDatabase::KernelTuningDatabase(const std::string &fileName) : fileName(fileName) {
+    enabled = (fileName != "unk");
+}
+
+KernelTuningDatabase::~KernelTuningDatabase() {
+    flush();
+}
+
+bool KernelTuningDatabase::find(const std::string &key, bool &singleSubdevicePreferred) {
+    std::lock_guard<std::mutex> lock(mutex);
+    loadEntries();
+
+    auto entry = entries.find(key);
+    if (entry == entries.end()) {
+        return false;
+    }
+    singleSubdevicePreferred = entry->second;
+    return true;
+}
+
+void KernelTuningDatabase::store(const std::string &key, bool singleSubdevicePreferred) {
+    std::lock_guard<std::mutex> lock(mutex);
+    loadEntries();
+
+    auto entry = entries.find(key);
+    if (entry != entries.end() && entry->second == singleSubdevicePreferred) {
+        return;
+    }
+    entries[key] = singleSubdevicePreferred;
+
+    pendingEntries++;
+    if (pendingEntries >= writeBatchSize) {
+        flushPendingEntries();
+    }
+}
+
+void KernelTuningDatabase::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    flushPendingEntries();
+}
+
+void KernelTuningDatabase::flushPendingEntries() {
+    if (pendingEntries == 0u) {
+        return;
+    }
+    pendingEntries = 0u;
+
+    // keep results other processes stored since this database was loaded
+    std::unordered_map<std::string, bool> fileEntries;
+    parseEntries(readDatabaseFile(), fileEntries);
+    for (const auto &[entryKey, entryValue] : fileEntries) {
+        entries.emplace(entryKey, entryValue);
+    }
+
+    std::ostringstream contents;
+    contents << versionHeader << "\n";
+    for (const auto &[entryKey, entryValue] : entries) {
+        contents << entryKey << " " << entryValue << "\n";
+    }
+    writeDatabaseFile(contents.str());
+}
+
+void KernelTuningDatabase::loadEntries() {
+    if (entriesLoaded) {
+        return;
+    }
+    entriesLoaded = true;
+    parseEntries(readDatabaseFile(), entries);
+}
+
+void KernelTuningDatabase::parseEntries(const std::string &contents, std::unordered_map<std::string, bool> &parsedEntries) const {
+    std::istringstream contentsStream(contents);
+    std::string line;
+    if (!std::getline(contentsStream, line) || line != versionHeader) {
+        return;
+    }
+
+    std::string key;
+    bool singleSubdevicePreferred = false;
+    while (contentsStream >> key >> singleSubdevicePreferred) {
+        parsedEntries[key] = singleSubdevicePreferred;
+    }
+}
+
+std::string KernelTuningDatabase::readDatabaseFile() {
+    auto fp = IoFunctions::fopenPtr(fileName.c_str(), "rb");
+    if (fp == nullptr) {
+        return {};
+    }
+    IoFunctions::fseekPtr(fp, 0, SEEK_END);
+    auto size = IoFunctions::ftellPtr(fp);
+    IoFunctions::rewindPtr(fp);
+
+    std::string contents;
+    if (size > 0) {
+        contents.resize(static_cast<size_t>(size));
+        contents.resize(IoFunctions::freadPtr(contents.data(), 1, contents.size(), fp));
+    }
+    IoFunctions::fclosePtr(fp);
+    return contents;
+}
+
+void KernelTuningDatabase::writeDatabaseFile(const std::string &contents) {
+    auto tempFileName = fileName + "." + std::to_string(SysCalls::getProcessId()) + ".tmp";
+    auto fp = IoFunctions::fopenPtr(tempFileName.c_str(), "wb");
+    if (fp == nullptr) {
+        return;
+    }
+    auto written = IoFunctions::fwritePtr(contents.c_str(), 1, contents.size(), fp);
+    IoFunctions::fclosePtr(fp);
+    replaceDatabaseFile(tempFileName, written == contents.size());
+}
+
+void KernelTuningDatabase::replaceDatabaseFile(const std::string &tempFileName, bool tempFileComplete) {
+    if (!tempFileComplete) {
+        std::remove(tempFileName.c_str());
+        return;
+    }
+    if (std::rename(tempFileName.c_str(), fileName.c_str()) != 0) {
+        // rename does not replace existing files on all platforms
+        std::remove(fileName.c_str());
+        if (std::rename(tempFileName.c_str(), fileName.c_str()) != 0) {
+            std::remove(tempFileName.c_str());
+        }
+    }
+}
+
+} // namespace NEO
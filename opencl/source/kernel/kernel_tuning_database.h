@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+
+// Keeps kernel tuning results between runs.
+// File starts with version header followed by one "<key> <singleSubdevicePreferred>" entry per line,
+// contents written with different version are dropped.
+// New results are written in batches and at destruction; each write goes to a temporary file
+// which is then renamed over the database, so readers never see a partially written file.
+class KernelTuningDatabase : NonCopyableOrMovableClass {
+  public:
+    static constexpr const char *versionHeader = "neo_kernel_tuning_db_v1";
+    static constexpr uint32_t writeBatchSize = 16u;
+
+    KernelTuningDatabase(const std::string &fileName);
+    MOCKABLE_VIRTUAL ~KernelTuningDatabase();
+
+    bool isEnabled() const { return enabled; }
+    bool find(const std::string &key, bool &singleSubdevicePreferred);
+    void store(const std::string &key, bool singleSubdevicePreferred);
+    void flush();
+
+  protected:
+    void loadEntries();
+    void parseEntries(const std::string &contents, std::unordered_map<std::string, bool> &parsedEntries) const;
+    void flushPendingEntries();
+    MOCKABLE_VIRTUAL std::string readDatabaseFile();
+    MOCKABLE_VIRTUAL void writeDatabaseFile(const std::string &contents);
+    MOCKABLE_VIRTUAL void replaceDatabaseFile(const std::string &tempFileName, bool tempFileComplete);
+
+    std::string fileName;
+    std::unordered_map<std::string, bool> entries;
+    std::mutex mutex;
+    uint32_t pendingEntries = 0u;
+    bool enabled = false;
+    bool entriesLoaded = false;
+};
+
+KernelTuningDatabase &kernelTuningDatabaseInstance();
+} // namespace NEO
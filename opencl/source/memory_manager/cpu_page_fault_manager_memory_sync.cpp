@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
@@ -28,4 +29,29 @@ void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     auto allocData = memoryData[ptr].unifiedMemoryManager->getSVMAlloc(ptr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
+void PageFaultManager::transferRangesToGpu(void *allocPtr, const std::vector<MemoryRange> &ranges, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto &pageFaultData = memoryData[allocPtr];
+    auto unifiedMemoryManager = pageFaultData.unifiedMemoryManager;
+    for (auto &range : ranges) {
+        // chunks of the range were mapped one by one on CPU faults, replace their map operations with one covering the whole range
+        for (size_t chunkOffset = 0u; chunkOffset < range.second; chunkOffset += pageFaultData.chunkSize) {
+            auto chunkPtr = ptrOffset(range.first, chunkOffset);
+            if (unifiedMemoryManager->getSvmMapOperation(chunkPtr)) {
+                unifiedMemoryManager->removeSvmMapOperation(chunkPtr);
+            }
+        }
+        unifiedMemoryManager->insertSvmMapOperation(range.first, range.second, allocPtr, ptrDiff(range.first, allocPtr), false);
+        auto retVal = commandQueue->enqueueSVMUnmap(range.first, 0, nullptr, nullptr, false);
+        UNRECOVERABLE_IF(retVal);
+    }
+    auto retVal = commandQueue->finish();
+    UNRECOVERABLE_IF(retVal);
+
+    auto allocData = unifiedMemoryManager->getSVMAlloc(allocPtr);
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
+}
+bool PageFaultManager::isChunkedMigrationSupported() const {
+    return true;
+}
 } // namespace NEO
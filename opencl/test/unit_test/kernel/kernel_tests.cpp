@@ -41,6 +41,7 @@
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 #include "opencl/test/unit_test/mocks/mock_kernel.h"
+#include "opencl/test/unit_test/mocks/mock_kernel_tuning_database.h"
 #include "opencl/test/unit_test/mocks/mock_program.h"
 #include "opencl/test/unit_test/program/program_from_binary.h"
 #include "opencl/test/unit_test/program/program_tests.h"
@@ -2040,6 +2041,51 @@ HWTEST_F(KernelResidencyTest, givenEnableFullKernelTuningWhenPerformTunningThenK
     EXPECT_EQ(result->second.singleSubdevicePreferred, mockKernel.mockKernel->singleSubdevicePreferredInCurrentEnqueue);
 }
 
+HWTEST_F(KernelResidencyTest, givenKernelTuningDatabaseWithResultWhenPerformFullTunningThenStoredResultIsUsedWithoutTunning) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableKernelTunning.set(2u);
+
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+
+    Vec3<size_t> lws{1, 1, 1};
+    Vec3<size_t> gws{1, 1, 1};
+    Vec3<size_t> offsets{1, 1, 1};
+    MockKernel::KernelConfig config{gws, lws, offsets};
+
+    MockKernelTuningDatabase database("tuning.db");
+    database.store(mockKernel.mockKernel->getKernelTuningKey(config), true);
+    mockKernel.mockKernel->kernelTuningDatabase = &database;
+
+    MockTimestampPacketContainer container(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, &container);
+
+    auto result = mockKernel.mockKernel->kernelSubmissionMap.find(config);
+    ASSERT_NE(result, mockKernel.mockKernel->kernelSubmissionMap.end());
+    EXPECT_EQ(result->second.status, MockKernel::TunningStatus::TUNNING_DONE);
+    EXPECT_EQ(result->second.kernelStandardTimestamps.get(), nullptr);
+    EXPECT_TRUE(mockKernel.mockKernel->singleSubdevicePreferredInCurrentEnqueue);
+
+    Vec3<size_t> otherGws{2, 1, 1};
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, otherGws, offsets, &container);
+    result = mockKernel.mockKernel->kernelSubmissionMap.find({otherGws, lws, offsets});
+    ASSERT_NE(result, mockKernel.mockKernel->kernelSubmissionMap.end());
+    EXPECT_EQ(result->second.status, MockKernel::TunningStatus::STANDARD_TUNNING_IN_PROGRESS);
+    EXPECT_FALSE(mockKernel.mockKernel->singleSubdevicePreferredInCurrentEnqueue);
+}
+
+TEST(KernelTuningKeyTest, givenDifferentKernelConfigsWhenGettingKernelTuningKeyThenKeysDiffer) {
+    auto device = clUniquePtr(new MockClDevice(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get())));
+    MockKernelWithInternals mockKernel(*device);
+
+    MockKernel::KernelConfig config{{1, 1, 1}, {1, 1, 1}, {0, 0, 0}};
+    MockKernel::KernelConfig otherConfig{{1, 1, 1}, {1, 1, 1}, {1, 0, 0}};
+    auto key = mockKernel.mockKernel->getKernelTuningKey(config);
+    EXPECT_EQ(key, mockKernel.mockKernel->getKernelTuningKey(config));
+    EXPECT_NE(key, mockKernel.mockKernel->getKernelTuningKey(otherConfig));
+    EXPECT_EQ(std::string::npos, key.find(' '));
+}
+
 HWTEST_F(KernelResidencyTest, givenSimpleKernelTunningAndNoAtomicsWhenPerformTunningThenSingleSubdeviceIsPreferred) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.EnableKernelTunning.set(1u);
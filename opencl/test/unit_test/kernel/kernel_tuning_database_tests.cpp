@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/mocks/mock_io_functions.h"
+
+#include "opencl/test/unit_test/mocks/mock_kernel_tuning_database.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+TEST(KernelTuningDatabaseTest, givenDefaultFileNameWhenDatabaseIsCreatedThenItIsDisabled) {
+    MockKernelTuningDatabase database("unk");
+    EXPECT_FALSE(database.isEnabled());
+
+    MockKernelTuningDatabase enabledDatabase("tuning.db");
+    EXPECT_TRUE(enabledDatabase.isEnabled());
+}
+
+TEST(KernelTuningDatabaseTest, givenDatabaseFileWithEntriesWhenFindIsCalledThenStoredResultsAreReturned) {
+    MockKernelTuningDatabase database("tuning.db");
+    database.fileContents = std::string(KernelTuningDatabase::versionHeader) + "\nkernelA 1\nkernelB 0\n";
+
+    bool singleSubdevicePreferred = false;
+    EXPECT_TRUE(database.find("kernelA", singleSubdevicePreferred));
+    EXPECT_TRUE(singleSubdevicePreferred);
+    EXPECT_TRUE(database.find("kernelB", singleSubdevicePreferred));
+    EXPECT_FALSE(singleSubdevicePreferred);
+    EXPECT_FALSE(database.find("kernelC", singleSubdevicePreferred));
+
+    EXPECT_EQ(1u, database.readDatabaseFileCalled);
+}
+
+TEST(KernelTuningDatabaseTest, givenDatabaseFileWithDifferentVersionWhenFindIsCalledThenEntriesAreIgnored) {
+    MockKernelTuningDatabase database("tuning.db");
+    database.fileContents = "neo_kernel_tuning_db_v0\nkernelA 1\n";
+
+    bool singleSubdevicePreferred = false;
+    EXPECT_FALSE(database.find("kernelA", singleSubdevicePreferred));
+    EXPECT_TRUE(database.entries.empty());
+}
+
+TEST(KernelTuningDatabaseTest, givenNewResultWhenStoreIsCalledThenDatabaseFileIsRewrittenWithAllEntriesOnFlush) {
+    MockKernelTuningDatabase database("tuning.db");
+    database.fileContents = std::string(KernelTuningDatabase::versionHeader) + "\nkernelA 1\n";
+
+    database.store("kernelB", false);
+    EXPECT_EQ(0u, database.writeDatabaseFileCalled);
+    EXPECT_EQ(1u, database.pendingEntries);
+
+    database.flush();
+    EXPECT_EQ(1u, database.writeDatabaseFileCalled);
+    EXPECT_EQ(0u, database.pendingEntries);
+
+    database.store("kernelB", false);
+    database.flush();
+    EXPECT_EQ(1u, database.writeDatabaseFileCalled);
+
+    MockKernelTuningDatabase reloadedDatabase("tuning.db");
+    reloadedDatabase.fileContents = database.fileContents;
+
+    bool singleSubdevicePreferred = false;
+    EXPECT_TRUE(reloadedDatabase.find("kernelA", singleSubdevicePreferred));
+    EXPECT_TRUE(singleSubdevicePreferred);
+    EXPECT_TRUE(reloadedDatabase.find("kernelB", singleSubdevicePreferred));
+    EXPECT_FALSE(singleSubdevicePreferred);
+}
+
+TEST(KernelTuningDatabaseTest, givenManyNewResultsWhenStoreIsCalledThenDatabaseFileIsWrittenOncePerBatch) {
+    MockKernelTuningDatabase database("tuning.db");
+
+    for (uint32_t i = 0; i < 2 * KernelTuningDatabase::writeBatchSize + 1; i++) {
+        database.store("kernel" + std::to_string(i), true);
+    }
+    EXPECT_EQ(2u, database.writeDatabaseFileCalled);
+    EXPECT_EQ(1u, database.pendingEntries);
+}
+
+TEST(KernelTuningDatabaseTest, givenResultsStoredByOtherProcessWhenFlushingThenTheyAreKept) {
+    MockKernelTuningDatabase database("tuning.db");
+    database.store("kernelA", true);
+    database.fileContents = std::string(KernelTuningDatabase::versionHeader) + "\nkernelA 0\nkernelB 1\n";
+
+    database.flush();
+
+    MockKernelTuningDatabase reloadedDatabase("tuning.db");
+    reloadedDatabase.fileContents = database.fileContents;
+    bool singleSubdevicePreferred = false;
+    EXPECT_TRUE(reloadedDatabase.find("kernelA", singleSubdevicePreferred));
+    EXPECT_TRUE(singleSubdevicePreferred);
+    EXPECT_TRUE(reloadedDatabase.find("kernelB", singleSubdevicePreferred));
+    EXPECT_TRUE(singleSubdevicePreferred);
+}
+
+namespace KernelTuningDatabaseTests {
+using FreadFunc = size_t (*)(void *, size_t, size_t, FILE *);
+using FwriteFunc = size_t (*)(const void *, size_t, size_t, FILE *);
+std::string writtenContents;
+std::vector<std::string> openedFiles;
+} // namespace KernelTuningDatabaseTests
+
+TEST(KernelTuningDatabaseTest, givenDatabaseFileWhenReadingThenContentsAreReadThroughIoFunctions) {
+    static const std::string contents = std::string(KernelTuningDatabase::versionHeader) + "\nkernelA 1\n";
+    VariableBackup<long int> ftellReturnBackup(&IoFunctions::mockFtellReturn, static_cast<long int>(contents.size()));
+    VariableBackup<KernelTuningDatabaseTests::FreadFunc> freadBackup(&IoFunctions::freadPtr, [](void *ptr, size_t size, size_t count, FILE *stream) -> size_t {
+        memcpy(ptr, contents.c_str(), std::min(size * count, contents.size()));
+        return std::min(size * count, contents.size());
+    });
+
+    MockKernelTuningDatabase database("tuning.db");
+    database.callBaseReadDatabaseFile = true;
+
+    bool singleSubdevicePreferred = false;
+    EXPECT_TRUE(database.find("kernelA", singleSubdevicePreferred));
+    EXPECT_TRUE(singleSubdevicePreferred);
+}
+
+TEST(KernelTuningDatabaseTest, givenMissingDatabaseFileWhenReadingThenNoEntriesAreLoaded) {
+    VariableBackup<FILE *> fopenReturnBackup(&IoFunctions::mockFopenReturned, nullptr);
+
+    MockKernelTuningDatabase database("tuning.db");
+    database.callBaseReadDatabaseFile = true;
+
+    bool singleSubdevicePreferred = false;
+    EXPECT_FALSE(database.find("kernelA", singleSubdevicePreferred));
+    EXPECT_TRUE(database.entries.empty());
+}
+
+TEST(KernelTuningDatabaseTest, givenPendingResultsWhenFlushingThenResultsAreWrittenToTemporaryFileWhichReplacesDatabase) {
+    KernelTuningDatabaseTests::writtenContents.clear();
+    KernelTuningDatabaseTests::openedFiles.clear();
+    VariableBackup<IoFunctions::fopenFuncPtr> fopenBackup(&IoFunctions::fopenPtr, [](const char *filename, const char *mode) -> FILE * {
+        KernelTuningDatabaseTests::openedFiles.push_back(filename);
+        return IoFunctions::mockFopenReturned;
+    });
+    VariableBackup<KernelTuningDatabaseTests::FwriteFunc> fwriteBackup(&IoFunctions::fwritePtr, [](const void *ptr, size_t size, size_t count, FILE *stream) -> size_t {
+        KernelTuningDatabaseTests::writtenContents.append(static_cast<const char *>(ptr), size * count);
+        return count;
+    });
+
+    std::string fileName = "tuning.db";
+    std::string tempFileName = fileName + "." + std::to_string(SysCalls::getProcessId()) + ".tmp";
+
+    MockKernelTuningDatabase database(fileName);
+    database.callBaseWriteDatabaseFile = true;
+    database.store("kernelA", true);
+    EXPECT_EQ(0u, database.replaceDatabaseFileCalled);
+
+    database.flush();
+    ASSERT_EQ(1u, KernelTuningDatabaseTests::openedFiles.size());
+    EXPECT_EQ(tempFileName, KernelTuningDatabaseTests::openedFiles[0]);
+    EXPECT_EQ(database.fileContents, KernelTuningDatabaseTests::writtenContents);
+    EXPECT_EQ(1u, database.replaceDatabaseFileCalled);
+    EXPECT_EQ(tempFileName, database.replacedTempFileName);
+    EXPECT_TRUE(database.replacedTempFileComplete);
+}
+
+TEST(KernelTuningDatabaseTest, givenShortWriteWhenFlushingThenTemporaryFileIsMarkedIncomplete) {
+    VariableBackup<size_t> fwriteReturnBackup(&IoFunctions::mockFwriteReturn, 0u);
+
+    MockKernelTuningDatabase database("tuning.db");
+    database.callBaseWriteDatabaseFile = true;
+    database.store("kernelA", true);
+    database.flush();
+
+    EXPECT_EQ(1u, database.replaceDatabaseFileCalled);
+    EXPECT_FALSE(database.replacedTempFileComplete);
+}
@@ -36,6 +36,7 @@
 #include "gtest/gtest.h"
 #include "os_inc.h"
 
+#include <csignal>
 #include <string>
 #include <string_view>
 
@@ -236,9 +237,6 @@ TEST_F(DrmFailedIoctlTests, givenPrintIoctlEntriesWhenCallFailedIoctlThenExpecte
 }
 
 TEST_F(DrmSimpleTests, givenPrintIoctlTimesWhenCallIoctlThenStatisticsAreGathered) {
-    constexpr long long initialMin = std::numeric_limits<long long>::max();
-    constexpr long long initialMax = std::numeric_limits<long long>::min();
-
     auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
     executionEnvironment->prepareRootDeviceEnvironments(1);
     auto drm = DrmWrap::createDrm(*executionEnvironment->rootDeviceEnvironments[0]);
@@ -247,80 +245,62 @@ TEST_F(DrmSimpleTests, givenPrintIoctlTimesWhenCallIoctlThenStatisticsAreGathere
     DebugManager.flags.PrintIoctlTimes.set(true);
     VariableBackup<decltype(forceExtraIoctlDuration)> backupForceExtraIoctlDuration(&forceExtraIoctlDuration, true);
 
-    EXPECT_TRUE(drm->ioctlStatistics.empty());
+    std::vector<DriverCallStatistics> statistics;
+    EXPECT_EQ(nullptr, drm->ioctlStatistics.load());
+    EXPECT_FALSE(drm->getDriverCallStatistics(statistics));
 
     int euTotal = 0u;
     uint32_t contextId = 1u;
 
     drm->getEuTotal(euTotal);
-    EXPECT_EQ(1u, drm->ioctlStatistics.size());
+    ASSERT_TRUE(drm->getDriverCallStatistics(statistics));
+    EXPECT_EQ(1u, statistics.size());
 
     drm->getEuTotal(euTotal);
-    EXPECT_EQ(1u, drm->ioctlStatistics.size());
+    EXPECT_TRUE(drm->getDriverCallStatistics(statistics));
+    EXPECT_EQ(1u, statistics.size());
 
     drm->setLowPriorityContextParam(contextId);
-    EXPECT_EQ(2u, drm->ioctlStatistics.size());
-
-    auto euTotalData = drm->ioctlStatistics.find(DrmIoctl::Getparam);
-    ASSERT_TRUE(euTotalData != drm->ioctlStatistics.end());
-    EXPECT_EQ(DrmIoctl::Getparam, euTotalData->first);
-    EXPECT_EQ(2u, euTotalData->second.count);
-    EXPECT_NE(0, euTotalData->second.totalTime);
-    EXPECT_NE(initialMin, euTotalData->second.minTime);
-    EXPECT_LE(euTotalData->second.minTime, euTotalData->second.maxTime);
-    EXPECT_LE(initialMax, euTotalData->second.minTime);
-    EXPECT_NE(initialMin, euTotalData->second.maxTime);
-    EXPECT_NE(initialMax, euTotalData->second.maxTime);
-    auto firstTime = euTotalData->second.totalTime;
-
-    auto lowPriorityData = drm->ioctlStatistics.find(DrmIoctl::GemContextSetparam);
-    ASSERT_TRUE(lowPriorityData != drm->ioctlStatistics.end());
-    EXPECT_EQ(DrmIoctl::GemContextSetparam, lowPriorityData->first);
-    EXPECT_EQ(1u, lowPriorityData->second.count);
-    EXPECT_NE(0, lowPriorityData->second.totalTime);
-    EXPECT_NE(initialMin, lowPriorityData->second.minTime);
-    EXPECT_NE(initialMax, lowPriorityData->second.minTime);
-    EXPECT_NE(initialMin, lowPriorityData->second.maxTime);
-    EXPECT_NE(initialMax, lowPriorityData->second.maxTime);
+    EXPECT_TRUE(drm->getDriverCallStatistics(statistics));
+    EXPECT_EQ(2u, statistics.size());
+
+    DriverCallStatistics euTotalData{};
+    ASSERT_TRUE(drm->ioctlStatistics.load()->getStatistics(DrmIoctl::Getparam, euTotalData));
+    EXPECT_EQ(2u, euTotalData.count);
+    EXPECT_NE(0u, euTotalData.totalTime);
+    EXPECT_NE(std::numeric_limits<uint64_t>::max(), euTotalData.minTime);
+    EXPECT_LE(euTotalData.minTime, euTotalData.maxTime);
+    EXPECT_LE(euTotalData.minTime, euTotalData.p50Time);
+    EXPECT_LE(euTotalData.p50Time, euTotalData.p90Time);
+    EXPECT_LE(euTotalData.p90Time, euTotalData.p99Time);
+    EXPECT_LE(euTotalData.p99Time, euTotalData.maxTime);
+    auto firstTime = euTotalData.totalTime;
+
+    DriverCallStatistics lowPriorityData{};
+    ASSERT_TRUE(drm->ioctlStatistics.load()->getStatistics(DrmIoctl::GemContextSetparam, lowPriorityData));
+    EXPECT_EQ(1u, lowPriorityData.count);
+    EXPECT_NE(0u, lowPriorityData.totalTime);
+    EXPECT_EQ(lowPriorityData.minTime, lowPriorityData.maxTime);
 
     drm->getEuTotal(euTotal);
-    EXPECT_EQ(drm->ioctlStatistics.size(), 2u);
-
-    euTotalData = drm->ioctlStatistics.find(DrmIoctl::Getparam);
-    ASSERT_TRUE(euTotalData != drm->ioctlStatistics.end());
-    EXPECT_EQ(DrmIoctl::Getparam, euTotalData->first);
-    EXPECT_EQ(3u, euTotalData->second.count);
-    EXPECT_NE(0u, euTotalData->second.totalTime);
+    EXPECT_TRUE(drm->getDriverCallStatistics(statistics));
+    EXPECT_EQ(2u, statistics.size());
 
-    auto secondTime = euTotalData->second.totalTime;
-    EXPECT_GT(secondTime, firstTime);
+    ASSERT_TRUE(drm->ioctlStatistics.load()->getStatistics(DrmIoctl::Getparam, euTotalData));
+    EXPECT_EQ(3u, euTotalData.count);
+    EXPECT_GT(euTotalData.totalTime, firstTime);
 
-    lowPriorityData = drm->ioctlStatistics.find(DrmIoctl::GemContextSetparam);
-    ASSERT_TRUE(lowPriorityData != drm->ioctlStatistics.end());
-    EXPECT_EQ(DrmIoctl::GemContextSetparam, lowPriorityData->first);
-    EXPECT_EQ(1u, lowPriorityData->second.count);
-    EXPECT_NE(0, lowPriorityData->second.totalTime);
+    ASSERT_TRUE(drm->ioctlStatistics.load()->getStatistics(DrmIoctl::GemContextSetparam, lowPriorityData));
+    EXPECT_EQ(1u, lowPriorityData.count);
 
     drm->destroyDrmContext(contextId);
-    EXPECT_EQ(3u, drm->ioctlStatistics.size());
-
-    euTotalData = drm->ioctlStatistics.find(DrmIoctl::Getparam);
-    ASSERT_TRUE(euTotalData != drm->ioctlStatistics.end());
-    EXPECT_EQ(DrmIoctl::Getparam, euTotalData->first);
-    EXPECT_EQ(3u, euTotalData->second.count);
-    EXPECT_NE(0, euTotalData->second.totalTime);
-
-    lowPriorityData = drm->ioctlStatistics.find(DrmIoctl::GemContextSetparam);
-    ASSERT_TRUE(lowPriorityData != drm->ioctlStatistics.end());
-    EXPECT_EQ(DrmIoctl::GemContextSetparam, lowPriorityData->first);
-    EXPECT_EQ(1u, lowPriorityData->second.count);
-    EXPECT_NE(0, lowPriorityData->second.totalTime);
-
-    auto destroyData = drm->ioctlStatistics.find(DrmIoctl::GemContextDestroy);
-    ASSERT_TRUE(destroyData != drm->ioctlStatistics.end());
-    EXPECT_EQ(DrmIoctl::GemContextDestroy, destroyData->first);
-    EXPECT_EQ(1u, destroyData->second.count);
-    EXPECT_NE(0, destroyData->second.totalTime);
+    EXPECT_TRUE(drm->getDriverCallStatistics(statistics));
+    EXPECT_EQ(3u, statistics.size());
+
+    DriverCallStatistics destroyData{};
+    ASSERT_TRUE(drm->ioctlStatistics.load()->getStatistics(DrmIoctl::GemContextDestroy, destroyData));
+    EXPECT_EQ(1u, destroyData.count);
+    EXPECT_NE(0u, destroyData.totalTime);
 
     ::testing::internal::CaptureStdout();
 
@@ -335,6 +315,8 @@ TEST_F(DrmSimpleTests, givenPrintIoctlTimesWhenCallIoctlThenStatisticsAreGathere
     std::string_view avgTimeString("Avg time per ioctl");
     std::string_view minString("Min");
     std::string_view maxString("Max");
+    std::string_view p99String("P99");
+    std::string_view errorsString("Errors");
 
     std::size_t position = output.find(requestString);
     EXPECT_NE(std::string::npos, position);
@@ -358,6 +340,56 @@ TEST_F(DrmSimpleTests, givenPrintIoctlTimesWhenCallIoctlThenStatisticsAreGathere
 
     position = output.find(maxString, position);
     EXPECT_NE(std::string::npos, position);
+    position += maxString.size();
+
+    position = output.find(p99String, position);
+    EXPECT_NE(std::string::npos, position);
+    position += p99String.size();
+
+    position = output.find(errorsString, position);
+    EXPECT_NE(std::string::npos, position);
+}
+
+static uint32_t previousDumpSignalHandlerCalled = 0u;
+static void previousDumpSignalHandler(int) {
+    previousDumpSignalHandlerCalled++;
+}
+
+TEST_F(DrmSimpleTests, givenIoctlStatisticsDumpSignalWhenSignalIsRaisedThenStatisticsArePrintedOnNextIoctl) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableIoctlStatistics.set(1);
+    DebugManager.flags.IoctlStatisticsDumpSignal.set(SIGUSR2);
+    previousDumpSignalHandlerCalled = 0u;
+    signal(SIGUSR2, previousDumpSignalHandler);
+
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    auto drm = DrmWrap::createDrm(*executionEnvironment->rootDeviceEnvironments[0]);
+
+    int euTotal = 0u;
+    ::testing::internal::CaptureStdout();
+    drm->getEuTotal(euTotal);
+    EXPECT_STREQ("", ::testing::internal::GetCapturedStdout().c_str());
+
+    raise(SIGUSR2);
+    EXPECT_EQ(1u, previousDumpSignalHandlerCalled);
+
+    ::testing::internal::CaptureStdout();
+    drm->getEuTotal(euTotal);
+    std::string output = ::testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("Ioctls statistics"));
+
+    ::testing::internal::CaptureStdout();
+    drm->getEuTotal(euTotal);
+    drm.reset();
+    EXPECT_STREQ("", ::testing::internal::GetCapturedStdout().c_str());
+
+    struct sigaction restoredAction = {};
+    sigaction(SIGUSR2, nullptr, &restoredAction);
+    EXPECT_EQ(0, restoredAction.sa_flags & SA_SIGINFO);
+    EXPECT_EQ(&previousDumpSignalHandler, restoredAction.sa_handler);
+
+    signal(SIGUSR2, SIG_DFL);
 }
 
 TEST_F(DrmSimpleTests, GivenSelectedNonExistingDeviceWhenOpenDirFailsThenRetryOpeningRenderDevicesAndNoDevicesAreCreated) {
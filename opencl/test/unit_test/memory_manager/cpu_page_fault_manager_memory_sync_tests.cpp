@@ -1,12 +1,14 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/test/common/fixtures/cpu_page_fault_manager_tests_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
@@ -105,3 +107,143 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenGpuTransferIsInvokedThen
     svmAllocsManager->freeSVMAlloc(alloc);
     cmdQ->device = nullptr;
 }
+
+struct ChunkedMigrationCommandQueueMock : public MockCommandQueue {
+    // mimics map operations bookkeeping of SVM map/unmap done by CommandQueueHw
+    cl_int enqueueSVMMap(cl_bool blockingMap, cl_map_flags mapFlags,
+                         void *svmPtr, size_t size,
+                         cl_uint numEventsInWaitList, const cl_event *eventWaitList,
+                         cl_event *event, bool externalAppCall) override {
+        if (svmAllocsManager->getSvmMapOperation(svmPtr) == nullptr) {
+            copiedToCpu.emplace_back(svmPtr, size);
+            svmAllocsManager->insertSvmMapOperation(svmPtr, size, svmBasePtr, ptrDiff(svmPtr, svmBasePtr), mapFlags == CL_MAP_READ);
+        }
+        return CL_SUCCESS;
+    }
+    cl_int enqueueSVMUnmap(void *svmPtr,
+                           cl_uint numEventsInWaitList, const cl_event *eventWaitList,
+                           cl_event *event, bool externalAppCall) override {
+        auto svmOperation = svmAllocsManager->getSvmMapOperation(svmPtr);
+        if (svmOperation) {
+            copiedToGpu.emplace_back(svmPtr, svmOperation->regionSize);
+            svmAllocsManager->removeSvmMapOperation(svmPtr);
+        }
+        return CL_SUCCESS;
+    }
+    cl_int finish() override {
+        finishCalled++;
+        return CL_SUCCESS;
+    }
+
+    SVMAllocsManager *svmAllocsManager = nullptr;
+    void *svmBasePtr = nullptr;
+    std::vector<std::pair<void *, size_t>> copiedToCpu;
+    std::vector<std::pair<void *, size_t>> copiedToGpu;
+    int finishCalled = 0;
+};
+
+class MockChunkedMigrationPageFaultManager : public MockPageFaultManager {
+  public:
+    void transferToCpu(void *ptr, size_t size, void *cmdQ) override {
+        PageFaultManager::transferToCpu(ptr, size, cmdQ);
+    }
+    void transferRangesToGpu(void *allocPtr, const std::vector<MemoryRange> &ranges, void *cmdQ) override {
+        PageFaultManager::transferRangesToGpu(allocPtr, ranges, cmdQ);
+    }
+};
+
+struct PageFaultManagerChunkedMigrationTest : public ::testing::Test {
+    void SetUp() override {
+        REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
+        DebugManager.flags.SharedAllocMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+        memoryManager = std::make_unique<MockMemoryManager>(executionEnvironment);
+        svmAllocsManager = std::make_unique<SVMAllocsManager>(memoryManager.get(), false);
+        device = std::unique_ptr<MockClDevice>(new MockClDevice{MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr)});
+        auto rootDeviceIndex = device->getRootDeviceIndex();
+        RootDeviceIndicesContainer rootDeviceIndices = {rootDeviceIndex};
+        std::map<uint32_t, DeviceBitfield> deviceBitfields{{rootDeviceIndex, device->getDeviceBitfield()}};
+        alloc = svmAllocsManager->createSVMAlloc(allocSize, {}, rootDeviceIndices, deviceBitfields);
+
+        cmdQ = std::make_unique<ChunkedMigrationCommandQueueMock>();
+        cmdQ->device = device.get();
+        cmdQ->svmAllocsManager = svmAllocsManager.get();
+        cmdQ->svmBasePtr = alloc;
+
+        MemoryProperties memoryProperties;
+        memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+        pageFaultManager.insertAllocation(alloc, allocSize, svmAllocsManager.get(), cmdQ.get(), memoryProperties);
+    }
+
+    void TearDown() override {
+        if (alloc) {
+            pageFaultManager.removeAllocation(alloc);
+            svmAllocsManager->freeSVMAlloc(alloc);
+            cmdQ->device = nullptr;
+        }
+    }
+
+    static constexpr size_t allocSize = 4 * MemoryConstants::pageSize;
+    DebugManagerStateRestore restorer;
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockMemoryManager> memoryManager;
+    std::unique_ptr<SVMAllocsManager> svmAllocsManager;
+    std::unique_ptr<MockClDevice> device;
+    std::unique_ptr<ChunkedMigrationCommandQueueMock> cmdQ;
+    MockChunkedMigrationPageFaultManager pageFaultManager;
+    void *alloc = nullptr;
+};
+
+TEST_F(PageFaultManagerChunkedMigrationTest, givenAdjacentChunksMigratedToCpuWhenMovingToGpuDomainThenWholeRangeIsCopiedAndChunkMapOperationsAreRemoved) {
+    pageFaultManager.moveAllocationToGpuDomain(alloc);
+
+    auto chunk1 = ptrOffset(alloc, MemoryConstants::pageSize);
+    auto chunk2 = ptrOffset(alloc, 2 * MemoryConstants::pageSize);
+    pageFaultManager.verifyPageFault(chunk1);
+    pageFaultManager.verifyPageFault(chunk2);
+    ASSERT_EQ(2u, cmdQ->copiedToCpu.size());
+    EXPECT_EQ(chunk1, cmdQ->copiedToCpu[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize, cmdQ->copiedToCpu[0].second);
+    EXPECT_EQ(chunk2, cmdQ->copiedToCpu[1].first);
+    EXPECT_EQ(MemoryConstants::pageSize, cmdQ->copiedToCpu[1].second);
+
+    pageFaultManager.moveAllocationToGpuDomain(alloc);
+    ASSERT_EQ(1u, cmdQ->copiedToGpu.size());
+    EXPECT_EQ(chunk1, cmdQ->copiedToGpu[0].first);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, cmdQ->copiedToGpu[0].second);
+    EXPECT_EQ(1, cmdQ->finishCalled);
+    EXPECT_EQ(nullptr, svmAllocsManager->getSvmMapOperation(chunk1));
+    EXPECT_EQ(nullptr, svmAllocsManager->getSvmMapOperation(chunk2));
+}
+
+TEST_F(PageFaultManagerChunkedMigrationTest, givenChunksMigratedBackToGpuWhenCpuFaultsOnChunkAgainThenChunkIsCopiedToCpu) {
+    pageFaultManager.moveAllocationToGpuDomain(alloc);
+
+    auto chunk1 = ptrOffset(alloc, MemoryConstants::pageSize);
+    auto chunk2 = ptrOffset(alloc, 2 * MemoryConstants::pageSize);
+    pageFaultManager.verifyPageFault(chunk1);
+    pageFaultManager.verifyPageFault(chunk2);
+    pageFaultManager.moveAllocationToGpuDomain(alloc);
+    cmdQ->copiedToCpu.clear();
+
+    pageFaultManager.verifyPageFault(chunk2);
+    ASSERT_EQ(1u, cmdQ->copiedToCpu.size());
+    EXPECT_EQ(chunk2, cmdQ->copiedToCpu[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize, cmdQ->copiedToCpu[0].second);
+}
+
+TEST_F(PageFaultManagerChunkedMigrationTest, givenAllocationInNoneDomainMovedToGpuWhenCpuFaultsOnChunkThenOnlyThisChunkIsCopiedToCpu) {
+    pageFaultManager.moveAllocationToGpuDomain(alloc);
+    EXPECT_TRUE(cmdQ->copiedToGpu.empty());
+
+    auto chunk3 = ptrOffset(alloc, 3 * MemoryConstants::pageSize);
+    pageFaultManager.verifyPageFault(ptrOffset(chunk3, 0x10));
+    ASSERT_EQ(1u, cmdQ->copiedToCpu.size());
+    EXPECT_EQ(chunk3, cmdQ->copiedToCpu[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize, cmdQ->copiedToCpu[0].second);
+
+    pageFaultManager.moveAllocationToGpuDomain(alloc);
+    ASSERT_EQ(1u, cmdQ->copiedToGpu.size());
+    EXPECT_EQ(chunk3, cmdQ->copiedToGpu[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize, cmdQ->copiedToGpu[0].second);
+}
@@ -36,8 +36,10 @@ struct MockEvent : public BaseEventType {
 
     using BaseEventType::timeStampNode;
     using Event::calcProfilingData;
+    using Event::dataCalculated;
     using Event::calculateSubmitTimestampData;
     using Event::isWaitForTimestampsEnabled;
+    using Event::logProfilingData;
     using Event::magic;
     using Event::multiRootDeviceTimestampPacketContainer;
     using Event::queueTimeStamp;
@@ -52,7 +54,15 @@ struct MockEvent : public BaseEventType {
         return BaseEventType::wait(blocking, useQuickKmdSleep);
     }
 
+    ChromeTraceLogger &getChromeTraceLogger() override {
+        if (chromeTraceLogger) {
+            return *chromeTraceLogger;
+        }
+        return BaseEventType::getChromeTraceLogger();
+    }
+
     std::optional<WaitStatus> waitReturnValue{};
+    ChromeTraceLogger *chromeTraceLogger = nullptr;
 };
 
 #undef FORWARD_CONSTRUCTOR
@@ -103,6 +103,7 @@ class MockKernel : public Kernel {
     using Kernel::executionType;
     using Kernel::getDevice;
     using Kernel::getHardwareInfo;
+    using Kernel::getKernelTuningKey;
     using Kernel::graphicsAllocationTypeUseSystemMemory;
     using Kernel::hasDirectStatelessAccessToHostMemory;
     using Kernel::hasDirectStatelessAccessToSharedBuffer;
@@ -114,6 +115,7 @@ class MockKernel : public Kernel {
     using Kernel::KernelConfig;
     using Kernel::kernelHasIndirectAccess;
     using Kernel::kernelSubmissionMap;
+    using Kernel::kernelTuningDatabase;
     using Kernel::kernelSvmGfxAllocations;
     using Kernel::kernelUnifiedMemoryGfxAllocations;
     using Kernel::localBindingTableOffset;
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "opencl/source/kernel/kernel_tuning_database.h"
+
+namespace NEO {
+
+class MockKernelTuningDatabase : public KernelTuningDatabase {
+  public:
+    using KernelTuningDatabase::entries;
+    using KernelTuningDatabase::KernelTuningDatabase;
+    using KernelTuningDatabase::pendingEntries;
+
+    ~MockKernelTuningDatabase() override {
+        flush();
+    }
+
+    std::string readDatabaseFile() override {
+        readDatabaseFileCalled++;
+        if (callBaseReadDatabaseFile) {
+            return KernelTuningDatabase::readDatabaseFile();
+        }
+        return fileContents;
+    }
+
+    void writeDatabaseFile(const std::string &contents) override {
+        writeDatabaseFileCalled++;
+        fileContents = contents;
+        if (callBaseWriteDatabaseFile) {
+            KernelTuningDatabase::writeDatabaseFile(contents);
+        }
+    }
+
+    void replaceDatabaseFile(const std::string &tempFileName, bool tempFileComplete) override {
+        replaceDatabaseFileCalled++;
+        replacedTempFileName = tempFileName;
+        replacedTempFileComplete = tempFileComplete;
+    }
+
+    std::string fileContents;
+    std::string replacedTempFileName;
+    uint32_t readDatabaseFileCalled = 0u;
+    uint32_t writeDatabaseFileCalled = 0u;
+    uint32_t replaceDatabaseFileCalled = 0u;
+    bool replacedTempFileComplete = false;
+    bool callBaseReadDatabaseFile = false;
+    bool callBaseWriteDatabaseFile = false;
+};
+} // namespace NEO
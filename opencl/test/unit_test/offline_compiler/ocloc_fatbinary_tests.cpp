@@ -1589,6 +1589,46 @@ TEST_F(OclocFatBinaryTest, givenClInputFileWhenFatBinaryIsRequestedThenArchiveDo
     EXPECT_EQ(decodedArchive.files.end(), spirvFileIt);
 }
 
+TEST_F(OclocFatBinaryTest, givenDedupFatbinaryOptionWhenFatBinaryIsRequestedThenOptionIsNotForwardedAndAllTargetsAreInArchive) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    const std::string clFilename = "some_kernel.cl";
+    mockArgHelperFilesMap[clFilename] = "__kernel void some_kernel(){}";
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        clFilename,
+        "-output_no_suffix",
+        "-dedup_fatbinary",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    const auto buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OclocErrorCode::SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+
+    const auto &rawArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    const auto archiveBytes = ArrayRef<const std::uint8_t>::fromAny(rawArchive.data(), rawArchive.size());
+
+    std::string outErrReason{};
+    std::string outWarning{};
+    const auto decodedArchive = NEO::Ar::decodeAr(archiveBytes, outErrReason, outWarning);
+
+    ASSERT_NE(nullptr, decodedArchive.magic);
+    ASSERT_TRUE(outErrReason.empty());
+    ASSERT_TRUE(outWarning.empty());
+
+    const auto isTargetBinary = [](const auto &file) { return false == file.fileName.startsWith("pad_"); };
+    EXPECT_EQ(2, std::count_if(decodedArchive.files.begin(), decodedArchive.files.end(), isTargetBinary));
+}
+
 TEST_F(OclocFatBinaryTest, givenEmptyFileWhenAppendingGenericIrThenInvalidFileIsReturned) {
     Ar::ArEncoder ar;
     std::string emptyFile{"empty_file.spv"};
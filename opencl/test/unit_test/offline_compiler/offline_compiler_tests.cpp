@@ -321,6 +321,69 @@ TEST_F(MultiCommandTests, GivenOutputFileListFlagWhenBuildingMultiCommandThenSuc
     delete pMultiCommand;
 }
 
+TEST_F(MultiCommandTests, GivenJobsCountWhenBuildingMultiCommandThenOutputsAreListedInCommandOrder) {
+    nameOfFileWithArgs = "ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-j",
+        "3",
+        "-output_file_list",
+        "outFileList.txt",
+    };
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    pMultiCommand = MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get());
+
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    outFileList = pMultiCommand->outputFileList;
+    ASSERT_TRUE(fileExists(outFileList));
+
+    std::vector<std::string> listedOutputs;
+    readFileToVectorOfStrings(listedOutputs, outFileList);
+    ASSERT_EQ(static_cast<size_t>(numOfBuild), listedOutputs.size());
+    for (int i = 0; i < numOfBuild; i++) {
+        std::string outFileName = pMultiCommand->outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_NE(std::string::npos, listedOutputs[i].find("build_no_" + std::to_string(i + 1) + ".bin"));
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+    }
+
+    deleteFileWithArgs();
+    deleteOutFileList();
+    delete pMultiCommand;
+}
+
+TEST(MultiCommandWhiteboxTest, GivenInvalidJobsCountWhenInitializingThenErrorIsReturned) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "multi",
+        "commands.txt",
+        "-j",
+        "0"};
+
+    ::testing::internal::CaptureStdout();
+    const auto result = mockMultiCommand.initialize(args);
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, result);
+    EXPECT_EQ("Invalid number of jobs: 0\n", output);
+    EXPECT_EQ(1u, mockMultiCommand.jobsCount);
+}
+
 TEST(MultiCommandWhiteboxTest, GivenVerboseModeWhenShowingResultsThenLogsArePrintedForEachBuild) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.retValues = {OclocErrorCode::SUCCESS, OclocErrorCode::INVALID_FILE};
@@ -390,6 +453,13 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds run concurrently.
+                                Calls into the compiler libraries
+                                are serialized, other build steps
+                                run in parallel. Logs of each build
+                                are printed in command order once
+                                all builds finish.
+
 )===";
 
     EXPECT_EQ(expectedOutput, output);
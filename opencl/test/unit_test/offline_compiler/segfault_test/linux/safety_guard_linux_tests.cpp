@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/offline_compiler/source/utilities/linux/safety_guard_linux.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+namespace {
+void dummySigAction(int sigNum, siginfo_t *info, void *ucontext) {}
+
+struct SafetyGuardLinuxTest : public ::testing::Test {
+    void SetUp() override {
+        struct sigaction dummyAction = {};
+        dummyAction.sa_sigaction = dummySigAction;
+        dummyAction.sa_flags = SA_SIGINFO;
+        sigemptyset(&dummyAction.sa_mask);
+        sigaction(SIGSEGV, &dummyAction, &originalAction);
+    }
+
+    void TearDown() override {
+        sigaction(SIGSEGV, &originalAction, nullptr);
+    }
+
+    static void *getInstalledSigAction() {
+        struct sigaction currentAction = {};
+        sigaction(SIGSEGV, nullptr, &currentAction);
+        return reinterpret_cast<void *>(currentAction.sa_sigaction);
+    }
+
+    struct sigaction originalAction = {};
+};
+} // namespace
+
+TEST_F(SafetyGuardLinuxTest, givenNestedGuardsWhenInnerGuardIsDestroyedThenHandlerStaysInstalledUntilLastGuardIsDestroyed) {
+    {
+        SafetyGuardLinux outerGuard;
+        EXPECT_EQ(reinterpret_cast<void *>(SafetyGuardLinux::sigAction), getInstalledSigAction());
+        {
+            SafetyGuardLinux innerGuard;
+            EXPECT_EQ(reinterpret_cast<void *>(SafetyGuardLinux::sigAction), getInstalledSigAction());
+        }
+        EXPECT_EQ(reinterpret_cast<void *>(SafetyGuardLinux::sigAction), getInstalledSigAction());
+    }
+    EXPECT_EQ(reinterpret_cast<void *>(dummySigAction), getInstalledSigAction());
+}
+
+TEST_F(SafetyGuardLinuxTest, givenGuardedCallsOnManyThreadsWhenAllThreadsFinishThenPreviousHandlerIsRestored) {
+    struct Callee {
+        int call() { return 1; }
+    };
+
+    constexpr int numThreads = 8;
+    std::vector<std::thread> threads;
+    std::vector<int> results(numThreads, 0);
+    for (int i = 0; i < numThreads; i++) {
+        threads.emplace_back([&results, i]() {
+            Callee callee;
+            for (int j = 0; j < 100; j++) {
+                SafetyGuardLinux safetyGuard;
+                results[i] += safetyGuard.call<int, Callee, decltype(&Callee::call)>(&callee, &Callee::call, 0);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (auto result : results) {
+        EXPECT_EQ(100, result);
+    }
+    EXPECT_EQ(reinterpret_cast<void *>(dummySigAction), getInstalledSigAction());
+}
@@ -5,7 +5,9 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/chrome_trace_logger.h"
 #include "shared/source/utilities/hw_timestamps.h"
 #include "shared/source/utilities/perf_counter.h"
 #include "shared/source/utilities/tag_allocator.h"
@@ -1264,6 +1266,119 @@ TEST_F(ProfilingTimestampPacketsTest, givenTimestampPacketWithoutProfilingDataWh
     EXPECT_EQ(static_cast<uint64_t>(globalEnd0), ev->getEndTimeStamp());
 }
 
+TEST_F(ProfilingTimestampPacketsTest, givenChromeTraceLoggerWhenLoggingProfilingDataThenHostAndGpuSpansAreWritten) {
+    DebugManager.flags.ReturnRawGpuTimestamps.set(false);
+    addTimestampNode(10, 11, 12, 13);
+    ev->calcProfilingData();
+
+    std::stringbuf traceBuffer;
+    {
+        ChromeTraceLogger chromeTraceLogger(std::make_unique<std::ostream>(&traceBuffer));
+        ev->logProfilingData(chromeTraceLogger);
+    }
+    auto trace = traceBuffer.str();
+
+    std::stringstream expectedGpuSpan;
+    expectedGpuSpan << "{\"name\":\"CL_COMMAND_USER\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << castToUint64(cmdQ.get()) << ",\"ts\":";
+    ChromeTraceLogger::writeTimestamp(expectedGpuSpan, ev->getStartTimeStamp());
+    expectedGpuSpan << ",\"dur\":";
+    ChromeTraceLogger::writeTimestamp(expectedGpuSpan, ev->getEndTimeStamp() - ev->getStartTimeStamp());
+    expectedGpuSpan << "}";
+
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"CL_COMMAND_USER queued\",\"cat\":\"host\""));
+    EXPECT_NE(std::string::npos, trace.find(expectedGpuSpan.str()));
+}
+
+TEST_F(ProfilingTimestampPacketsTest, givenDeviceBasedTimestampsWhenLoggingProfilingDataThenGpuSpanIsConvertedToCpuTime) {
+    DebugManager.flags.ReturnRawGpuTimestamps.set(false);
+    DebugManager.flags.EnableDeviceBasedTimestamps.set(true);
+    addTimestampNode(10, 11, 120, 130);
+
+    ev->queueTimeStamp.cpuTimeinNS = 1000000u;
+    ev->queueTimeStamp.gpuTimeStamp = 100u;
+    ev->submitTimeStamp.cpuTimeinNS = 1000500u;
+    ev->calcProfilingData();
+
+    std::stringbuf traceBuffer;
+    {
+        ChromeTraceLogger chromeTraceLogger(std::make_unique<std::ostream>(&traceBuffer));
+        ev->logProfilingData(chromeTraceLogger);
+    }
+    auto trace = traceBuffer.str();
+
+    auto &device = cmdQ->getDevice();
+    double resolution = device.getDeviceInfo().profilingTimerResolution;
+    uint64_t gpuQueueTimeInNs = device.getGfxCoreHelper().getGpuTimeStampInNS(ev->queueTimeStamp.gpuTimeStamp, resolution);
+    uint64_t expectedStart = ev->getStartTimeStamp() + ev->queueTimeStamp.cpuTimeinNS - gpuQueueTimeInNs;
+
+    std::stringstream expectedHostSpan;
+    expectedHostSpan << "{\"name\":\"CL_COMMAND_USER queued\",\"cat\":\"host\",\"ph\":\"X\",\"pid\":0,\"tid\":" << castToUint64(cmdQ.get()) << ",\"ts\":";
+    ChromeTraceLogger::writeTimestamp(expectedHostSpan, 1000000u);
+    expectedHostSpan << ",\"dur\":";
+    ChromeTraceLogger::writeTimestamp(expectedHostSpan, 500u);
+    expectedHostSpan << "}";
+
+    std::stringstream expectedGpuSpan;
+    expectedGpuSpan << "{\"name\":\"CL_COMMAND_USER\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << castToUint64(cmdQ.get()) << ",\"ts\":";
+    ChromeTraceLogger::writeTimestamp(expectedGpuSpan, expectedStart);
+    expectedGpuSpan << ",\"dur\":";
+    ChromeTraceLogger::writeTimestamp(expectedGpuSpan, ev->getEndTimeStamp() - ev->getStartTimeStamp());
+    expectedGpuSpan << "}";
+
+    EXPECT_NE(std::string::npos, trace.find(expectedHostSpan.str()));
+    EXPECT_NE(std::string::npos, trace.find(expectedGpuSpan.str()));
+}
+
+TEST_F(ProfilingTimestampPacketsTest, givenChromeTraceLoggerEnabledWhenProfiledEventCompletesThenProfilingDataIsExportedWithoutQuery) {
+    DebugManager.flags.ReturnRawGpuTimestamps.set(false);
+
+    std::stringbuf traceBuffer;
+    ChromeTraceLogger chromeTraceLogger(std::make_unique<std::ostream>(&traceBuffer));
+    MockEvent<MyEvent> event(cmdQ.get(), CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    event.setProfilingEnabled(true);
+    event.chromeTraceLogger = &chromeTraceLogger;
+    event.timestampPacketContainer = std::make_unique<MockTimestampContainer>();
+
+    auto node = new MockTagNode<TimestampPackets<uint32_t>>();
+    node->tagForCpuAccess = new TimestampPackets<uint32_t>();
+    uint32_t values[4] = {10, 12, 11, 13};
+    node->tagForCpuAccess->assignDataToAllTimestamps(0, values);
+    event.timestampPacketContainer->add(node);
+
+    *cmdQ->getGpgpuCommandStreamReceiver().getTagAddress() = 0u;
+    event.updateExecutionStatus();
+
+    EXPECT_EQ(CL_COMPLETE, event.peekExecutionStatus());
+    EXPECT_NE(std::string::npos, traceBuffer.str().find("{\"name\":\"CL_COMMAND_NDRANGE_KERNEL\",\"cat\":\"gpu\""));
+    EXPECT_NE(std::string::npos, traceBuffer.str().find("{\"name\":\"CL_COMMAND_NDRANGE_KERNEL queued\",\"cat\":\"host\""));
+}
+
+TEST_F(ProfilingTimestampPacketsTest, givenChromeTraceLoggerDisabledWhenProfiledEventCompletesThenProfilingDataIsNotCalculated) {
+    ChromeTraceLogger chromeTraceLogger(std::unique_ptr<std::ostream>{});
+    MockEvent<MyEvent> event(cmdQ.get(), CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    event.setProfilingEnabled(true);
+    event.chromeTraceLogger = &chromeTraceLogger;
+
+    *cmdQ->getGpgpuCommandStreamReceiver().getTagAddress() = 0u;
+    event.updateExecutionStatus();
+
+    EXPECT_EQ(CL_COMPLETE, event.peekExecutionStatus());
+    EXPECT_FALSE(event.dataCalculated);
+}
+
+TEST_F(ProfilingTimestampPacketsTest, givenReturnRawGpuTimestampsSetWhenLoggingProfilingDataThenNothingIsWritten) {
+    DebugManager.flags.ReturnRawGpuTimestamps.set(true);
+    addTimestampNode(10, 11, 12, 13);
+    ev->calcProfilingData();
+
+    std::stringbuf traceBuffer;
+    {
+        ChromeTraceLogger chromeTraceLogger(std::make_unique<std::ostream>(&traceBuffer));
+        ev->logProfilingData(chromeTraceLogger);
+    }
+    EXPECT_STREQ("[\n]\n", traceBuffer.str().c_str());
+}
+
 TEST_F(ProfilingTimestampPacketsTest, givenPrintTimestampPacketContentsSetWhenCalcProfilingDataThenTimeStampsArePrinted) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.PrintTimestampPacketContents.set(true);
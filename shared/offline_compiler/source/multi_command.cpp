@@ -11,7 +11,12 @@
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
 #include "shared/source/utilities/const_stringref.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <memory>
+#include <thread>
 
 namespace NEO {
 int MultiCommand::singleBuild(const std::vector<std::string> &args) {
@@ -103,6 +108,13 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             pathToCommandFile = args[++argIndex];
         } else if (hasMoreArgs && ConstStringRef("-output_file_list") == currArg) {
             outputFileList = args[++argIndex];
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            const auto requestedJobs = std::atoi(args[++argIndex].c_str());
+            if (requestedJobs <= 0) {
+                argHelper->printf("Invalid number of jobs: %s\n", args[argIndex].c_str());
+                return OclocErrorCode::INVALID_COMMAND_LINE;
+            }
+            jobsCount = static_cast<uint32_t>(requestedJobs);
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
         } else {
@@ -133,6 +145,11 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
+    if (jobsCount > 1u && lines.size() > 1u && !argHelper->outputEnabled()) {
+        runBuildsInParallel(argZero);
+        return;
+    }
+
     for (size_t i = 0; i < lines.size(); ++i) {
         std::vector<std::string> args = {argZero};
 
@@ -152,6 +169,74 @@ void MultiCommand::runBuilds(const std::string &argZero) {
     }
 }
 
+void MultiCommand::runBuildsInParallel(const std::string &argZero) {
+    struct BuildJob {
+        std::vector<std::string> args;
+        std::unique_ptr<OclocArgHelper> argHelper;
+        std::unique_ptr<MultiCommand> worker;
+        int retVal = OclocErrorCode::SUCCESS;
+        long long elapsedTime = 0;
+    };
+
+    std::vector<BuildJob> jobs(lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto &job = jobs[i];
+        job.args = {argZero};
+
+        job.retVal = splitLineInSeparateArgs(job.args, lines[i], i);
+        if (job.retVal != OclocErrorCode::SUCCESS) {
+            continue;
+        }
+        addAdditionalOptionsToSingleCommandLine(job.args, i);
+
+        // each job logs into its own printer, logs are printed in command order once all jobs finish
+        job.argHelper = std::make_unique<OclocArgHelper>();
+        job.argHelper->getPrinterRef().setSuppressMessages(true);
+        job.worker.reset(new MultiCommand());
+        job.worker->argHelper = job.argHelper.get();
+        job.worker->quiet = quiet;
+        job.worker->outDirForBuilds = outDirForBuilds;
+        job.worker->outFileName = outFileName;
+    }
+
+    std::atomic<size_t> nextJob{0u};
+    auto runJobs = [&jobs, &nextJob]() {
+        for (auto jobId = nextJob++; jobId < jobs.size(); jobId = nextJob++) {
+            auto &job = jobs[jobId];
+            if (job.worker) {
+                auto start = std::chrono::steady_clock::now();
+                job.retVal = job.worker->singleBuild(job.args);
+                auto end = std::chrono::steady_clock::now();
+                job.elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const auto threadsCount = std::min(static_cast<size_t>(jobsCount), jobs.size());
+    for (size_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back(runJobs);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        auto &job = jobs[i];
+        if (job.worker) {
+            if (!quiet) {
+                argHelper->printf("Command number %zu: \n", i + 1);
+            }
+            argHelper->printf("%s", job.argHelper->getPrinterRef().getLog().str().c_str());
+            if (!quiet) {
+                argHelper->printf("Command number %zu took %lld ms\n", i + 1, job.elapsedTime);
+            }
+            outputFile << job.worker->outputFile.str();
+        }
+        retValues.push_back(job.retVal);
+    }
+}
+
 void MultiCommand::printHelp() {
     argHelper->printf(R"===(Compiles multiple files using a config file.
 
@@ -167,6 +252,13 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds run concurrently.
+                                Calls into the compiler libraries
+                                are serialized, other build steps
+                                run in parallel. Logs of each build
+                                are printed in command order once
+                                all builds finish.
+
 )===");
 }
 
@@ -296,11 +296,22 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
     bool spirvInput = false;
     bool excludeIr = false;
+    bool deduplicateBinaries = false;
+
+    // packer-only option, not forwarded to per-target compilations
+    std::vector<std::string> argsCopy;
+    argsCopy.reserve(args.size());
+    for (const auto &arg : args) {
+        if (ConstStringRef("-dedup_fatbinary") == arg) {
+            deduplicateBinaries = true;
+        } else {
+            argsCopy.push_back(arg);
+        }
+    }
 
-    std::vector<std::string> argsCopy(args);
-    for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
-        const auto &currArg = args[argIndex];
-        const bool hasMoreArgs = (argIndex + 1 < args.size());
+    for (size_t argIndex = 1; argIndex < argsCopy.size(); argIndex++) {
+        const auto &currArg = argsCopy[argIndex];
+        const bool hasMoreArgs = (argIndex + 1 < argsCopy.size());
         if ((ConstStringRef("-device") == currArg) && hasMoreArgs) {
             deviceArgIndex = argIndex + 1;
             ++argIndex;
@@ -309,13 +320,13 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         } else if ((CompilerOptions::arch64bit == currArg) || (ConstStringRef("-64") == currArg)) {
             pointerSizeInBits = "64";
         } else if ((ConstStringRef("-file") == currArg) && hasMoreArgs) {
-            inputFileName = args[argIndex + 1];
+            inputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if (((ConstStringRef("-output") == currArg) || (ConstStringRef("-o") == currArg)) && hasMoreArgs) {
-            outputFileName = args[argIndex + 1];
+            outputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if ((ConstStringRef("-out_dir") == currArg) && hasMoreArgs) {
-            outputDirectory = args[argIndex + 1];
+            outputDirectory = argsCopy[argIndex + 1];
             ++argIndex;
         } else if (ConstStringRef("-exclude_ir") == currArg) {
             excludeIr = true;
@@ -334,11 +345,11 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         return OclocErrorCode::INVALID_COMMAND_LINE;
     }
 
-    Ar::ArEncoder fatbinary(true);
+    Ar::ArEncoder fatbinary(true, deduplicateBinaries);
     std::vector<ConstStringRef> targetProducts;
-    targetProducts = getTargetProductsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
+    targetProducts = getTargetProductsForFatbinary(ConstStringRef(argsCopy[deviceArgIndex]), argHelper);
     if (targetProducts.empty()) {
-        argHelper->printf("Failed to parse target devices from : %s\n", args[deviceArgIndex].c_str());
+        argHelper->printf("Failed to parse target devices from : %s\n", argsCopy[deviceArgIndex].c_str());
         return 1;
     }
     for (const auto &product : targetProducts) {
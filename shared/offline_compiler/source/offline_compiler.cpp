@@ -30,6 +30,7 @@
 #include <iomanip>
 #include <iterator>
 #include <list>
+#include <mutex>
 
 #ifdef _WIN32
 #include <direct.h>
@@ -45,6 +46,10 @@ using namespace NEO::OclocErrorCode;
 
 namespace NEO {
 
+// FCL and IGC entry points are not known to be reentrant, builds run concurrently by ocloc multi -j
+// take this lock around every call into the compiler libraries
+static std::mutex compilerInterfaceMutex;
+
 std::string convertToPascalCase(const std::string &inString) {
     std::string outString;
     bool capitalize = true;
@@ -78,7 +83,10 @@ std::string getSupportedDevices(OclocArgHelper *helper) {
 
 OfflineCompiler::OfflineCompiler() = default;
 OfflineCompiler::~OfflineCompiler() {
+    std::lock_guard<std::mutex> lock(compilerInterfaceMutex);
     pBuildInfo.reset();
+    igcFacade.reset();
+    fclFacade.reset();
     delete[] irBinary;
     delete[] genBinary;
     delete[] debugDataBinary;
@@ -401,10 +409,13 @@ int OfflineCompiler::buildSourceCode() {
 
 int OfflineCompiler::build() {
     int retVal = SUCCESS;
-    if (isOnlySpirV()) {
-        retVal = buildIrBinary();
-    } else {
-        retVal = buildSourceCode();
+    {
+        std::lock_guard<std::mutex> lock(compilerInterfaceMutex);
+        if (isOnlySpirV()) {
+            retVal = buildIrBinary();
+        } else {
+            retVal = buildSourceCode();
+        }
     }
     generateElfBinary();
     if (dumpFiles) {
@@ -636,6 +647,7 @@ int OfflineCompiler::initialize(size_t numArgs, const std::vector<std::string> &
         sourceCode = (source != nullptr) ? getStringWithinDelimiters(sourceFromFile.get()) : sourceFromFile.get();
     }
 
+    std::lock_guard<std::mutex> lock(compilerInterfaceMutex);
     if ((inputFileSpirV == false) && (inputFileLlvm == false)) {
         const auto fclInitializationResult = fclFacade->initialize(hwInfo);
         if (fclInitializationResult != SUCCESS) {
@@ -1037,6 +1049,11 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
   -config                       Target hardware info config for a single device,
                                 e.g 1x4x8.
 
+  -dedup_fatbinary              When building a fatbinary, stores byte-identical
+                                device binaries of different targets only once.
+                                Remaining targets are recorded as aliases
+                                of the stored entry.
+
 Examples :
   Compile file to Intel Compute GPU device binary (out = source_file_Gen9core.bin)
     ocloc -file source_file.cl -device skl
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,26 +8,39 @@
 #pragma once
 #include "shared/source/helpers/abort.h"
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <execinfo.h>
+#include <mutex>
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
+static thread_local jmp_buf jmpbuf;
+static thread_local bool jmpbufSet = false;
 
 class SafetyGuardLinux {
   public:
+    // Signal handlers are process wide, guards living on concurrent threads share one installation.
     SafetyGuardLinux() {
-        struct sigaction sigact;
+        std::lock_guard<std::mutex> lock(installMutex);
+        if (installCount++ > 0) {
+            return;
+        }
+        struct sigaction sigact = {};
 
         sigact.sa_sigaction = sigAction;
         sigact.sa_flags = SA_RESTART | SA_SIGINFO;
+        sigemptyset(&sigact.sa_mask);
         sigaction(SIGSEGV, &sigact, &previousSigSegvAction);
         sigaction(SIGILL, &sigact, &previousSigIllvAction);
     }
 
     ~SafetyGuardLinux() {
+        std::lock_guard<std::mutex> lock(installMutex);
+        if (--installCount > 0) {
+            return;
+        }
         if (previousSigSegvAction.sa_sigaction) {
             sigaction(SIGSEGV, &previousSigSegvAction, NULL);
         }
@@ -50,6 +63,10 @@ class SafetyGuardLinux {
         }
 
         free(callstack);
+        if (!jmpbufSet) {
+            // signal raised on a thread which is not inside a guarded call
+            NEO::abortExecution();
+        }
         longjmp(jmpbuf, 1);
     }
 
@@ -59,8 +76,12 @@ class SafetyGuardLinux {
         jump = setjmp(jmpbuf);
 
         if (jump == 0) {
-            return (object->*method)();
+            jmpbufSet = true;
+            T retValue = (object->*method)();
+            jmpbufSet = false;
+            return retValue;
         } else {
+            jmpbufSet = false;
             if (onSigSegv) {
                 onSigSegv();
             } else {
@@ -72,6 +93,10 @@ class SafetyGuardLinux {
 
     typedef void (*callbackFunction)();
     callbackFunction onSigSegv = nullptr;
-    struct sigaction previousSigSegvAction = {};
-    struct sigaction previousSigIllvAction = {};
+
+  protected:
+    static inline std::mutex installMutex;
+    static inline uint32_t installCount = 0u;
+    static inline struct sigaction previousSigSegvAction = {};
+    static inline struct sigaction previousSigIllvAction = {};
 };
@@ -41,6 +41,23 @@ class AubHelper : public NonCopyableOrMovableClass {
         }
     }
 
+    static bool isGpuReadOnlyAllocationType(const AllocationType &type) {
+        switch (type) {
+        case AllocationType::COMMAND_BUFFER:
+        case AllocationType::RING_BUFFER:
+        case AllocationType::LINEAR_STREAM:
+        case AllocationType::INTERNAL_HEAP:
+        case AllocationType::INDIRECT_OBJECT_HEAP:
+        case AllocationType::INSTRUCTION_HEAP:
+        case AllocationType::SURFACE_STATE_HEAP:
+        case AllocationType::KERNEL_ISA:
+        case AllocationType::KERNEL_ISA_INTERNAL:
+            return true;
+        default:
+            return false;
+        }
+    }
+
     static uint64_t getTotalMemBankSize();
     static int getMemTrace(uint64_t pdEntryBits);
     static uint64_t getPTEntryBits(uint64_t pdEntryBits);
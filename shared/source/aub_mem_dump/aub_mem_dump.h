@@ -11,6 +11,7 @@
 #include <fstream>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace NEO {
 class AubHelper;
@@ -139,10 +140,12 @@ struct AubFileStream : public AubStream {
                                        uint32_t addressSpace, uint32_t compareOperation);
     MOCKABLE_VIRTUAL bool addComment(const char *message);
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
+    bool updatePageHash(uint64_t physAddress, uint64_t pageHash);
 
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+    std::unordered_map<uint64_t, uint64_t> pageHashes; // hashes of pages written to current file, keyed by physical address
 };
 
 template <int addressingBits>
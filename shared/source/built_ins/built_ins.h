@@ -138,7 +138,8 @@ class EmbeddedStorage : public Storage {
 class BuiltinsLib {
   public:
     BuiltinsLib();
-    BuiltinCode getBuiltinCode(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device);
+    MOCKABLE_VIRTUAL ~BuiltinsLib() = default;
+    MOCKABLE_VIRTUAL BuiltinCode getBuiltinCode(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device);
 
   protected:
     BuiltinResourceT getBuiltinResource(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device);
@@ -93,11 +93,22 @@ extern const size_t g_dwordCountMax;
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+    pageHashes.clear();
 }
 
 void AubFileStream::close() {
     fileHandle.close();
     fileName.clear();
+    pageHashes.clear();
+}
+
+bool AubFileStream::updatePageHash(uint64_t physAddress, uint64_t pageHash) {
+    auto pageHashIt = pageHashes.find(physAddress);
+    if (pageHashIt != pageHashes.end() && pageHashIt->second == pageHash) {
+        return false;
+    }
+    pageHashes[physAddress] = pageHash;
+    return true;
 }
 
 void AubFileStream::write(const char *data, size_t size) {
@@ -111,6 +111,7 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
 
     bool dumpAubNonWritable = false;
     bool isEngineInitialized = false;
+    bool writingGpuReadOnlyAllocation = false;
     ExternalAllocationsContainer externalAllocations;
 
     TaskCountType pollForCompletionTaskCount = 0u;
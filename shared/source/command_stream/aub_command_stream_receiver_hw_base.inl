@@ -652,8 +652,19 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
     }
 
     AubHelperHw<GfxFamily> aubHelperHw(this->isLocalMemoryEnabled());
+    // GPU writes are not visible in the hashes, so only pages the GPU never modifies can be skipped
+    const bool skipUnchangedPages = writingGpuReadOnlyAllocation && DebugManager.flags.AUBDumpSkipUnchangedPages.get();
 
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        if (skipUnchangedPages) {
+            Hash pageHash;
+            pageHash.update(reinterpret_cast<const char *>(ptrOffset(cpuAddress, offset)), size);
+            pageHash.update(reinterpret_cast<const char *>(&gpuAddress), sizeof(gpuAddress));
+            pageHash.update(reinterpret_cast<const char *>(&entryBits), sizeof(entryBits));
+            if (!getAubStream()->updatePageHash(physAddress, pageHash.finish())) {
+                return;
+            }
+        }
         AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
     };
@@ -682,7 +693,9 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
     if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
     } else {
+        writingGpuReadOnlyAllocation = AubHelper::isGpuReadOnlyAllocationType(gfxAllocation.getAllocationType());
         writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        writingGpuReadOnlyAllocation = false;
     }
 
     streamLocked.unlock();
@@ -37,6 +37,7 @@ DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueReadOnly, false, "Force dumpi
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueSVMMemcpyOnly, false, "Force dumping allocations on clEnqueueSVMMemcpy only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
 DECLARE_DEBUG_VARIABLE(bool, GenerateAubFilePerProcessId, false, "Generate aub file with process id")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpSkipUnchangedPages, false, "Skip writing pages of GPU read-only allocations (command buffers, heaps, ISA) to AUB file when their content did not change since they were last written to the same file, works without aubstream only")
 
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableSWTags, false, "Enable software tagging in batch buffer")
@@ -132,6 +133,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmAllocationSize, -1, "-1: default, >=0
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerLogBitmask, 0, "0: logs disabled, 1 - INFO, 2 - ERROR, 1<<10 - Dump elf, see DebugVariables::DEBUGGER_LOG_BITMASK")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerOptDisable, -1, "-1: default from debugger query, 0: do not add opt-disable, 1: add opt-disable")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerForceSbaTrackingMode, -1, "-1: default, 0: per context address spaces, 1: single address space")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDebuggerStateSaveAreaSnapshot, -1, "-1: default (disabled), 0: disabled, 1: snapshot whole state save area when threads stop and serve register reads from it until resume")
+DECLARE_DEBUG_VARIABLE(int32_t, DebuggerStateSaveAreaSnapshotChunkSize, -1, "-1: default (16MB), >0: size in bytes of a single read used when taking state save area snapshot")
 DECLARE_DEBUG_VARIABLE(int32_t, DebugApiUsed, 0, "0: default L0 Debug API not used, 1: L0 Debug API used")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideCsrAllocationSize, -1, "-1: default, >0: use value for size of CSR allocation")
 DECLARE_DEBUG_VARIABLE(int32_t, CFEComputeOverdispatchDisable, -1, "Set Compute Overdispatch Disable field in CFE_STATE, -1: do not set.")
@@ -160,6 +163,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideBlitterTargetMemory, -1, "-1:default 0:
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideBlitterMocs, -1, "-1: default, 0: Uncached, 1: Cached")
 DECLARE_DEBUG_VARIABLE(int32_t, OverridePostSyncMocs, -1, "-1: default, >=0 Override post sync mocs with value")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateVmBindExt, -1, "Use immediate bind extension to a new residency model on Linux (requires kernel support), -1: default (enabled with direct submission), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableVmBindBatching, -1, "Coalesce vm binds issued while making allocations resident into a single array-bind ioctl (requires kernel support), -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceExecutionTile, -1, "-1: default, 0+: given tile is chosen as submission, must be used with EnableWalkerPartition = 0.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideTimestampPacketSize, -1, "-1: default, >0: size in bytes. 4 and 8 supported for experiments")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideMaxWorkGroupCount, -1, "-1: default, >0: Max WG size")
@@ -238,8 +242,19 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExitOnSubmissionNumber, -1, "Call exit(0) on X s
 DECLARE_DEBUG_VARIABLE(int32_t, ExitOnSubmissionMode, 0, "Exit on X submission mode. 0: Any context type, 1: Compute context only, 2: Copy context only ")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceInOrderImmediateCmdListExecution, -1, "-1: default, 0: disabled, 1: all Immediate Command Lists are switched to in-order execution")
 DECLARE_DEBUG_VARIABLE(int64_t, OverrideEventSynchronizeTimeout, -1, "-1: default - user provided timeout value,  >0: timeout in nanoseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, EventsWaitSpinBudgetUs, -1, "-1: default (100), >=0: time in microseconds multi-event wait polls events without sleeping")
+DECLARE_DEBUG_VARIABLE(int32_t, EventsWaitMaxSleepUs, -1, "-1: default (128), >0: upper bound in microseconds of backoff sleep in multi-event wait once spin budget is used")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventPoolSlabAllocator, -1, "-1: default (disabled), 0: disabled, 1: enabled. When enabled, small host visible event pools are sub-allocated from shared slabs and their memory is recycled on destroy")
+DECLARE_DEBUG_VARIABLE(int64_t, EventPoolSlabSize, -1, "-1: default (2MB), >0: size in bytes of a single slab of event pool slab allocator")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceTlbFlush, -1, "-1: default,  0: Tlb flush disabled, 1: Tlb Flush enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DebugSetMemoryDiagnosticsDelay, -1, "-1: default, >=0: delay time in minutes necessary for completion of Memory diagnostics")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSysmanSampler, -1, "-1: default (disabled), 0: disabled, 1: enabled, sysman device starts a thread sampling counters at a fixed rate into a ring buffer")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanSamplerPeriodMs, -1, "-1: default (100), >0: sysman sampler period in milliseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanSamplerCounterMask, -1, "-1: default (all), >=0: bitmask of sampled counters, 1: energy, 2: temperature, 4: frequency, 8: engine activity, 16: memory bandwidth")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanSamplerRingCapacity, -1, "-1: default (64), >0: number of samples kept in sysman sampler ring buffer")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanSamplerServeQueries, -1, "-1: default (disabled), 0: disabled, 1: energy, temperature, engine activity and memory bandwidth queries are answered from latest sample when it is recent")
+DECLARE_DEBUG_VARIABLE(std::string, SysmanSamplerSharedMemoryName, std::string("unk"), "When different value than \"unk\", sysman sampler ring is published in shared memory of given name suffixed with _<root device index>")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSysmanSysfsWriteCache, -1, "-1: default (disabled), 0: disabled, 1: enabled, sysfs attribute writes of same value as last successful write are skipped")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceStateVerification, -1, "-1: default, 0: disable, 1: enable check of device state before submit on Windows")
 
 /*LOGGING FLAGS*/
@@ -280,12 +295,16 @@ DECLARE_DEBUG_VARIABLE(bool, PrintTagAllocationAddress, false, "Print tag alloca
 DECLARE_DEBUG_VARIABLE(bool, ProvideVerboseImplicitFlush, false, "provides verbose messages about implicit flush mechanism")
 DECLARE_DEBUG_VARIABLE(bool, PrintBlitDispatchDetails, false, "Print blit dispatch details")
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlTimes, false, "Print ioctl times")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIoctlStatistics, -1, "Collect per-ioctl call counts, latency histograms and errno breakdown, queryable at runtime, -1: default (enabled with PrintIoctlTimes), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, IoctlStatisticsDumpSignal, -1, "-1: default, >0: print collected ioctl statistics on the next ioctl after receiving given signal number")
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlEntries, false, "Print ioctl being called")
 DECLARE_DEBUG_VARIABLE(bool, PrintUmdSharedMigration, false, "Print log message when shared allocation is being migrated by UMD")
+DECLARE_DEBUG_VARIABLE(int32_t, SharedAllocMigrationChunkSize, -1, "-1: default (migrate whole shared allocation), >0: size in bytes (aligned up to page size) of chunks in which UMD migrates shared allocations on CPU page fault")
 DECLARE_DEBUG_VARIABLE(bool, PrintImageBlitBlockCopyCmdDetails, false, "Prints XY_BLOCK_COPY_BLT command details")
 DECLARE_DEBUG_VARIABLE(bool, PrintCompletionFenceUsage, false, "Prints all usages of DRM completion fences")
 DECLARE_DEBUG_VARIABLE(bool, LogGdiCalls, false, "Log GDI calls")
 DECLARE_DEBUG_VARIABLE(bool, LogGdiCallsToFile, false, "Log GDI calls to file")
+DECLARE_DEBUG_VARIABLE(std::string, ChromeTraceFile, std::string("unk"), "When different value than \"unk\", profiled events timeline is written to given file in Chrome trace format")
 
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
@@ -323,12 +342,14 @@ DECLARE_DEBUG_VARIABLE(int32_t, DeferCmdQBcsInitialization, -1, "-1: default, 0:
 DECLARE_DEBUG_VARIABLE(int32_t, PreferInternalBcsEngine, -1, "-1: default, 0:disabled, 1: enabled. When enabled use internal BCS engine for internal transfers, when disabled use regular engine")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsCopy, -1, "-1: default, 0:disabled, 1: enabled. When enqueues copy to main copy engine then split between even linked copy engines")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsSize, -1, "-1: default, >=0: Size to apply BCS split from")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsSubcopyAlignment, -1, "-1: default (even split), >0: size in KB to which each BCS split subcopy is aligned, engines left without data are not used")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMask, 0, "0: default, >0: bitmask: indicates bcs engines for split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskH2D, 0, "0: default, >0: bitmask: indicates bcs engines for H2D split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskD2H, 0, "0: default, >0: bitmask: indicates bcs engines for D2H split")
 DECLARE_DEBUG_VARIABLE(int32_t, ReuseKernelBinaries, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver reuses kernel binaries.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocations, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers and heaps at initialization of immediate command list.")
 DECLARE_DEBUG_VARIABLE(int32_t, UseHighAlignmentForHeapExtended, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver aligns HEAP_EXTENDED allocations to GPU VA that is next power of 2 for a given size, if disables GPU VA is using 2MB/64KB alignment.")
+DECLARE_DEBUG_VARIABLE(int32_t, WarmUpBuiltinsAsync, -1, "-1: default, 0: disabled, 1: enabled. Where async builtin init is supported, enabled builds all builtin kernels used by memory copy and fill at L0 device creation instead of only immediate fill; disabled builds none")
 DECLARE_DEBUG_VARIABLE(int32_t, DispatchCmdlistCmdBufferPrimary, -1, "-1: default, 0: dispatch command buffers as seconadry, 1: dispatch command buffers as primary and chain")
 
 /*DIRECT SUBMISSION FLAGS*/
@@ -388,8 +409,13 @@ DECLARE_DEBUG_VARIABLE(int32_t, ReturnSubDevicesAsApiDevices, -1, "Expose each s
 DECLARE_DEBUG_VARIABLE(int32_t, ForceRunAloneContext, -1, "Control creation of run-alone HW context, -1:default, 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, AddClGlSharing, -1, "Add cl-gl extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTunning, -1, "Perform a tunning of enqueue kernel, -1:default(disabled), 0:disable, 1:enable simple kernel tunning, 2:enable full kernel tunning")
+DECLARE_DEBUG_VARIABLE(std::string, KernelTunningDatabaseFile, std::string("unk"), "When different value than \"unk\", results of full kernel tunning are loaded from and stored to given file")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBOMmapCreate, -1, "Create BOs using mmap, -1:default, 0:disable(GEM_USERPTR), 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableGemCloseWorker, -1, "Use asynchronous gem object closing, -1:default, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDeferredAllocationTeardown, -1, "Hand munmap, gem close and gpu range release of freed allocations over to gem close worker, -1:default(disable), 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseWorkerMaxBacklog, -1, "Number of queued teardown requests above which freeing thread tears down allocation itself, -1:default(16384)")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGpuVaArenas, -1, "Serve small gpu va allocations from standard heaps out of per thread arenas, -1:default(disable), 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, GpuVaArenaSizeInMb, -1, "Size of gpu va range reserved at once for an arena, -1:default(256MB)")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrValidation, -1, "Validate BO from GEM_USERPTR, -1:default(enable), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelAdvancedVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_advanced_motion_estimation extension")
@@ -30,8 +30,15 @@ namespace SpecialFileNames {
 inline constexpr ConstStringRef longFileNamesFile = "//";
 inline constexpr char longFileNamePrefix = '/';
 inline constexpr char fileNameTerminator = '/';
+inline constexpr ConstStringRef fileAliasesFile = "__aliases";
 } // namespace SpecialFileNames
 
+// Each line of the aliases file is "<alias name> <name of file entry holding the data>\n"
+namespace FileAliases {
+inline constexpr char nameSeparator = ' ';
+inline constexpr char entryTerminator = '\n';
+} // namespace FileAliases
+
 } // namespace Ar
 
 } // namespace NEO
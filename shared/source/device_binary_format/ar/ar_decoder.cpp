@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace NEO {
@@ -57,15 +58,95 @@ Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std
                     return {};
                 }
             }
-            ret.files.push_back(fileEntry);
+            if (SpecialFileNames::fileAliasesFile == fileEntry.fileName) {
+                ret.fileAliasesEntry = fileEntry;
+            } else {
+                ret.files.push_back(fileEntry);
+            }
         }
 
         decodePos = fileEntryDataPos + fileSize;
         decodePos += fileSize & 1U; // implicit 2-byte alignment
     }
+    resolveFileAliases(ret, outWarnings);
+    createFilesIndex(ret);
     return ret;
 }
 
+void resolveFileAliases(Ar &archive, std::string &outWarnings) {
+    ConstStringRef aliases(reinterpret_cast<const char *>(archive.fileAliasesEntry.fileData.begin()), archive.fileAliasesEntry.fileData.size());
+    const auto filesCount = archive.files.size();
+    size_t entryBegin = 0U;
+    while (entryBegin < aliases.size()) {
+        size_t entryEnd = entryBegin;
+        size_t separatorPos = aliases.size();
+        while ((entryEnd < aliases.size()) && (aliases[entryEnd] != FileAliases::entryTerminator)) {
+            if ((separatorPos == aliases.size()) && (aliases[entryEnd] == FileAliases::nameSeparator)) {
+                separatorPos = entryEnd;
+            }
+            ++entryEnd;
+        }
+        if (separatorPos < entryEnd) {
+            ConstStringRef aliasName(aliases.begin() + entryBegin, separatorPos - entryBegin);
+            ConstStringRef targetName(aliases.begin() + separatorPos + 1, entryEnd - separatorPos - 1);
+            bool targetFound = false;
+            for (size_t i = 0; i < filesCount; ++i) {
+                if (archive.files[i].fileName == targetName) {
+                    ArFileEntryHeaderAndData aliasEntry = {};
+                    aliasEntry.fileName = aliasName;
+                    aliasEntry.fileData = archive.files[i].fileData;
+                    archive.files.push_back(aliasEntry);
+                    targetFound = true;
+                    break;
+                }
+            }
+            if (false == targetFound) {
+                outWarnings.append("File alias '" + aliasName.str() + "' points to missing file entry '" + targetName.str() + "'\n");
+            }
+        }
+        entryBegin = entryEnd + 1;
+    }
+}
+
+void createFilesIndex(Ar &archive) {
+    archive.filesIndex.clear();
+    if (archive.files.size() < minFilesCountForIndex) {
+        return;
+    }
+    archive.filesIndex.reserve(archive.files.size());
+    for (size_t i = 0; i < archive.files.size(); ++i) {
+        archive.filesIndex.emplace_back(archive.files[i].fileName, i);
+    }
+    std::sort(archive.filesIndex.begin(), archive.filesIndex.end(), [](const auto &lhs, const auto &rhs) {
+        return std::lexicographical_compare(lhs.first.begin(), lhs.first.end(), rhs.first.begin(), rhs.first.end());
+    });
+}
+
+ArFileEntryHeaderAndData *findFileWithPrefix(Ar &archive, const ConstStringRef prefix) {
+    if (archive.filesIndex.empty()) {
+        for (auto &file : archive.files) {
+            if (file.fileName.startsWith(prefix)) {
+                return &file;
+            }
+        }
+        return nullptr;
+    }
+
+    auto it = std::lower_bound(archive.filesIndex.begin(), archive.filesIndex.end(), prefix, [](const auto &entry, const ConstStringRef &prefix) {
+        return std::lexicographical_compare(entry.first.begin(), entry.first.end(), prefix.begin(), prefix.end());
+    });
+
+    // files sharing the prefix are adjacent in the index, prefer the one stored first in the archive
+    size_t matchedPosition = archive.files.size();
+    for (; (it != archive.filesIndex.end()) && it->first.startsWith(prefix); ++it) {
+        matchedPosition = std::min(matchedPosition, it->second);
+    }
+    if (matchedPosition < archive.files.size()) {
+        return &archive.files[matchedPosition];
+    }
+    return nullptr;
+}
+
 } // namespace Ar
 
 } // namespace NEO
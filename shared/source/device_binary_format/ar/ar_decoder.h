@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,9 @@
 #include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <utility>
+#include <vector>
+
 namespace NEO {
 namespace Ar {
 
@@ -19,13 +22,20 @@ struct ArFileEntryHeaderAndData {
     ConstStringRef fileName;
     ArrayRef<const uint8_t> fileData;
 
-    const ArFileEntryHeader *fullHeader = nullptr;
+    const ArFileEntryHeader *fullHeader = nullptr; // nullptr for entries resolved from file aliases, they have no header of their own
 };
 
+using FilesIndex = std::vector<std::pair<ConstStringRef, size_t>>;
+
+// sorting pays off only for fatbinaries with many targets, smaller archives are scanned linearly
+inline constexpr size_t minFilesCountForIndex = 32U;
+
 struct Ar {
     const char *magic = nullptr;
     StackVec<ArFileEntryHeaderAndData, 32> files;
     ArFileEntryHeaderAndData longFileNamesEntry;
+    ArFileEntryHeaderAndData fileAliasesEntry;
+    FilesIndex filesIndex; // file names sorted with positions in files, empty for small archives
 };
 
 inline bool isAr(const ArrayRef<const uint8_t> binary) {
@@ -79,6 +89,10 @@ inline ConstStringRef readLongFileName(ConstStringRef longFileNamesSection, size
     return ConstStringRef(longFileNamesSection.begin() + offset, end - offset);
 }
 
+void resolveFileAliases(Ar &archive, std::string &outWarnings);
+void createFilesIndex(Ar &archive);
+ArFileEntryHeaderAndData *findFileWithPrefix(Ar &archive, const ConstStringRef prefix);
+
 Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std::string &outWarnings);
 
 } // namespace Ar
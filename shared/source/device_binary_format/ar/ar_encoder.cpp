@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/string.h"
 
 #include <vector>
@@ -23,6 +24,25 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
         return nullptr;
     }
 
+    uint64_t fileDataHash = 0U;
+    if (deduplicateFiles && (false == fileData.empty())) {
+        fileDataHash = Hash::hash(reinterpret_cast<const char *>(fileData.begin()), fileData.size());
+        auto identicalFileEntry = findIdenticalFileEntry(fileData, fileDataHash);
+        if (nullptr != identicalFileEntry) {
+            fileAliases.append(fileName.begin(), fileName.size());
+            fileAliases.push_back(FileAliases::nameSeparator);
+            fileAliases.append(identicalFileEntry->fileName);
+            fileAliases.push_back(FileAliases::entryTerminator);
+
+            auto &aliasHeader = aliasFileEntries.emplace_back();
+            memcpy_s(aliasHeader.identifier, sizeof(aliasHeader.identifier), fileName.begin(), fileName.size());
+            aliasHeader.identifier[fileName.size()] = SpecialFileNames::fileNameTerminator;
+            auto sizeString = std::to_string(fileData.size());
+            memcpy_s(aliasHeader.fileSizeInBytes, sizeof(aliasHeader.fileSizeInBytes), sizeString.c_str(), sizeString.size());
+            return &aliasHeader;
+        }
+    }
+
     auto alignedFileSize = fileData.size() + (fileData.size() & 1U);
     ArFileEntryHeader header = {};
 
@@ -50,14 +70,41 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
     this->fileEntries.insert(this->fileEntries.end(), reinterpret_cast<uint8_t *>(&header), reinterpret_cast<uint8_t *>(&header + 1));
     this->fileEntries.insert(this->fileEntries.end(), fileData.begin(), fileData.end());
     this->fileEntries.resize(this->fileEntries.size() + alignedFileSize - fileData.size(), 0U); // implicit 2-byte alignment
+    if (deduplicateFiles && (false == fileData.empty())) {
+        encodedFilesByHash.insert({fileDataHash, EncodedFileEntry{fileName.str(), newFileHeaderOffset, fileData.size()}});
+    }
     return reinterpret_cast<ArFileEntryHeader *>(this->fileEntries.data() + newFileHeaderOffset);
 }
 
+const ArEncoder::EncodedFileEntry *ArEncoder::findIdenticalFileEntry(const ArrayRef<const uint8_t> fileData, uint64_t fileDataHash) const {
+    auto candidates = encodedFilesByHash.equal_range(fileDataHash);
+    for (auto candidate = candidates.first; candidate != candidates.second; ++candidate) {
+        const auto &encodedFile = candidate->second;
+        auto encodedFileData = this->fileEntries.data() + encodedFile.headerOffset + sizeof(ArFileEntryHeader);
+        if ((encodedFile.dataSize == fileData.size()) && (0 == memcmp(encodedFileData, fileData.begin(), fileData.size()))) {
+            return &encodedFile;
+        }
+    }
+    return nullptr;
+}
+
 std::vector<uint8_t> ArEncoder::encode() const {
     std::vector<uint8_t> ret;
     ret.reserve(arMagic.size() + 1);
     ret.insert(ret.end(), reinterpret_cast<const uint8_t *>(arMagic.begin()), reinterpret_cast<const uint8_t *>(arMagic.end()));
     ret.insert(ret.end(), this->fileEntries.begin(), this->fileEntries.end());
+
+    if (false == fileAliases.empty()) {
+        ArFileEntryHeader aliasesHeader = {};
+        memcpy_s(aliasesHeader.identifier, sizeof(aliasesHeader.identifier), SpecialFileNames::fileAliasesFile.begin(), SpecialFileNames::fileAliasesFile.size());
+        aliasesHeader.identifier[SpecialFileNames::fileAliasesFile.size()] = SpecialFileNames::fileNameTerminator;
+        auto sizeString = std::to_string(fileAliases.size());
+        UNRECOVERABLE_IF(sizeString.length() > sizeof(aliasesHeader.fileSizeInBytes));
+        memcpy_s(aliasesHeader.fileSizeInBytes, sizeof(aliasesHeader.fileSizeInBytes), sizeString.c_str(), sizeString.size());
+        ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&aliasesHeader), reinterpret_cast<uint8_t *>(&aliasesHeader + 1));
+        ret.insert(ret.end(), fileAliases.begin(), fileAliases.end());
+        ret.resize(ret.size() + (fileAliases.size() & 1U), 0U); // implicit 2-byte alignment
+    }
     return ret;
 }
 
@@ -12,19 +12,35 @@
 #include "shared/source/utilities/const_stringref.h"
 
 #include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
 namespace Ar {
 
 struct ArEncoder {
-    ArEncoder(bool padTo8Bytes = false) : padTo8Bytes(padTo8Bytes) {}
+    ArEncoder(bool padTo8Bytes = false, bool deduplicateFiles = false) : padTo8Bytes(padTo8Bytes), deduplicateFiles(deduplicateFiles) {}
+    // for a file deduplicated into an alias, returned header describes the alias but is not encoded
     ArFileEntryHeader *appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData);
     std::vector<uint8_t> encode() const;
 
   protected:
+    struct EncodedFileEntry {
+        std::string fileName;
+        size_t headerOffset = 0U;
+        size_t dataSize = 0U;
+    };
+
+    const EncodedFileEntry *findIdenticalFileEntry(const ArrayRef<const uint8_t> fileData, uint64_t fileDataHash) const;
+
     std::vector<uint8_t> fileEntries;
+    std::unordered_multimap<uint64_t, EncodedFileEntry> encodedFilesByHash;
+    std::string fileAliases;
+    std::deque<ArFileEntryHeader> aliasFileEntries;
     bool padTo8Bytes = false;
+    bool deduplicateFiles = false;
     uint32_t paddingEntry = 0U;
 };
 
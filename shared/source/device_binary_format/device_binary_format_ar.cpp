@@ -11,15 +11,6 @@
 #include "shared/source/helpers/string.h"
 
 namespace NEO {
-void searchForBinary(Ar::Ar &archiveData, const ConstStringRef filter, Ar::ArFileEntryHeaderAndData *&matched) {
-    for (auto &file : archiveData.files) {
-        if (file.fileName.startsWith(filter.str().c_str())) {
-            matched = &file;
-            return;
-        }
-    }
-}
-
 template <>
 bool isDeviceBinaryFormat<NEO::DeviceBinaryFormat::Archive>(const ArrayRef<const uint8_t> binary) {
     return NEO::Ar::isAr(binary);
@@ -47,11 +38,11 @@ SingleDeviceBinary unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Archive>(co
     Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndPlatform = matchedFiles[3];
     Ar::ArFileEntryHeaderAndData *&matchedGenericIr = matchedFiles[4];
 
-    searchForBinary(archiveData, ConstStringRef(filterPointerSizeAndMajorMinorRevision), matchedPointerSizeAndMajorMinorRevision);
-    searchForBinary(archiveData, ConstStringRef(filterPointerSizeAndPlatformAndStepping), matchedPointerSizeAndPlatformAndStepping);
-    searchForBinary(archiveData, ConstStringRef(filterPointerSizeAndMajorMinor), matchedPointerSizeAndMajorMinor);
-    searchForBinary(archiveData, ConstStringRef(filterPointerSizeAndPlatform), matchedPointerSizeAndPlatform);
-    searchForBinary(archiveData, filterGenericIrFileName, matchedGenericIr);
+    matchedPointerSizeAndMajorMinorRevision = Ar::findFileWithPrefix(archiveData, ConstStringRef(filterPointerSizeAndMajorMinorRevision));
+    matchedPointerSizeAndPlatformAndStepping = Ar::findFileWithPrefix(archiveData, ConstStringRef(filterPointerSizeAndPlatformAndStepping));
+    matchedPointerSizeAndMajorMinor = Ar::findFileWithPrefix(archiveData, ConstStringRef(filterPointerSizeAndMajorMinor));
+    matchedPointerSizeAndPlatform = Ar::findFileWithPrefix(archiveData, ConstStringRef(filterPointerSizeAndPlatform));
+    matchedGenericIr = Ar::findFileWithPrefix(archiveData, filterGenericIrFileName);
 
     std::string unpackErrors;
     std::string unpackWarnings;
@@ -8,12 +8,16 @@
 #include "shared/source/helpers/blit_helper.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/blit_properties.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 namespace BlitHelperFunctions {
@@ -74,4 +78,13 @@ BlitOperationResult BlitHelper::blitMemoryToAllocationBanks(const Device &device
     return BlitOperationResult::Success;
 }
 
+size_t BlitHelper::getBcsSplitSubcopySize(size_t remainingSize, size_t remainingEngines) {
+    auto subcopySize = remainingSize / remainingEngines;
+    if (DebugManager.flags.SplitBcsSubcopyAlignment.get() > 0) {
+        auto alignment = static_cast<size_t>(DebugManager.flags.SplitBcsSubcopyAlignment.get()) * MemoryConstants::kiloByte;
+        subcopySize = Math::divideAndRoundUp(subcopySize, alignment) * alignment;
+    }
+    return std::min(subcopySize, remainingSize);
+}
+
 } // namespace NEO
@@ -37,6 +37,7 @@ struct BlitHelper {
                                                       const Vec3<size_t> &size);
     static BlitOperationResult blitMemoryToAllocationBanks(const Device &device, GraphicsAllocation *memory, size_t offset, const void *hostPtr,
                                                            const Vec3<size_t> &size, DeviceBitfield memoryBanks);
+    static size_t getBcsSplitSubcopySize(size_t remainingSize, size_t remainingEngines);
 };
 
 } // namespace NEO
\ No newline at end of file
@@ -7,13 +7,18 @@
 
 #include "shared/source/memory_manager/gfx_partition.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/utilities/arena_heap_allocator.h"
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/heap_allocator.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace NEO {
 
 const std::array<HeapIndex, 4> GfxPartition::heap32Names{{HeapIndex::HEAP_INTERNAL_DEVICE_MEMORY,
@@ -96,7 +101,22 @@ static void reserve57BitRangeWithMemoryMapsParse(OSMemory *osMemory, OSMemory::R
 
 GfxPartition::GfxPartition(OSMemory::ReservedCpuAddressRange &reservedCpuAddressRangeForHeapSvm) : reservedCpuAddressRangeForHeapSvm(reservedCpuAddressRangeForHeapSvm), osMemory(OSMemory::create()) {}
 
+const std::array<HeapIndex, 3> GfxPartition::heapStandardNames{{HeapIndex::HEAP_STANDARD,
+                                                                HeapIndex::HEAP_STANDARD64KB,
+                                                                HeapIndex::HEAP_STANDARD2MB}};
+
 GfxPartition::~GfxPartition() {
+    for (auto heapName : GfxPartition::heapStandardNames) {
+        ArenaHeapStatistics statistics;
+        if (getHeapArenaStatistics(heapName, statistics)) {
+            PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stdout,
+                               "GPU VA arenas of heap %u: %zu arenas, reserved %llu, used %llu, fragmentation %.2f%%, allocations %llu, bypassed %llu\n",
+                               static_cast<uint32_t>(heapName), statistics.arenaCount,
+                               static_cast<unsigned long long>(statistics.reservedSize), static_cast<unsigned long long>(statistics.usedSize),
+                               statistics.getFragmentation() * 100.0,
+                               static_cast<unsigned long long>(statistics.arenaAllocations), static_cast<unsigned long long>(statistics.bypassedAllocations));
+        }
+    }
     osMemory->releaseCpuAddressRange(reservedCpuAddressRangeForHeapSvm);
     reservedCpuAddressRangeForHeapSvm = {};
     osMemory->releaseCpuAddressRange(reservedCpuAddressRangeForHeapExtended);
@@ -105,6 +125,8 @@ GfxPartition::~GfxPartition() {
 void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAlignment) {
     this->base = base;
     this->size = size;
+    this->allocationAlignment = allocationAlignment;
+    arenas.reset();
 
     auto heapGranularity = GfxPartition::heapGranularity;
     if (allocationAlignment > heapGranularity) {
@@ -147,17 +169,60 @@ void GfxPartition::Heap::initFrontWindow(uint64_t base, uint64_t size) {
 }
 
 uint64_t GfxPartition::Heap::allocate(size_t &size) {
-    return alloc->allocate(size);
+    return allocateWithCustomAlignment(size, 0u);
 }
 
 uint64_t GfxPartition::Heap::allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment) {
+    if (arenas) {
+        auto ptr = arenas->allocateWithCustomAlignment(sizeToAllocate, alignment);
+        if (ptr != 0llu) {
+            return ptr;
+        }
+    }
     return alloc->allocateWithCustomAlignment(sizeToAllocate, alignment);
 }
 
 void GfxPartition::Heap::free(uint64_t ptr, size_t size) {
+    if (arenas && arenas->free(ptr, size)) {
+        return;
+    }
     alloc->free(ptr, size);
 }
 
+void GfxPartition::Heap::initArenas(size_t arenaSize, uint32_t numStripes) {
+    arenas = std::make_unique<ArenaHeapAllocator>(*alloc, arenaSize, allocationAlignment, numStripes);
+}
+
+bool GfxPartition::Heap::getArenaStatistics(ArenaHeapStatistics &statistics) const {
+    if (!arenas) {
+        return false;
+    }
+    arenas->getStatistics(statistics);
+    return true;
+}
+
+void GfxPartition::initHeapArenas() {
+    if (DebugManager.flags.EnableGpuVaArenas.get() != 1) {
+        return;
+    }
+
+    size_t arenaSize = 256 * MemoryConstants::megaByte;
+    if (DebugManager.flags.GpuVaArenaSizeInMb.get() != -1) {
+        arenaSize = static_cast<size_t>(DebugManager.flags.GpuVaArenaSizeInMb.get()) * MemoryConstants::megaByte;
+    }
+    arenaSize = alignUp(arenaSize, ArenaHeapAllocator::arenaAlignment);
+    auto numStripes = std::clamp(std::thread::hardware_concurrency(), 1u, 16u);
+
+    for (auto heapName : GfxPartition::heapStandardNames) {
+        auto &heap = getHeap(heapName);
+        // arenas only pay off when heap can host many of them without starving direct allocations
+        if (heap.getSize() < static_cast<uint64_t>(arenaSize) * numStripes * 16) {
+            continue;
+        }
+        heap.initArenas(arenaSize, numStripes);
+    }
+}
+
 void GfxPartition::freeGpuAddressRange(uint64_t ptr, size_t size) {
     for (auto heapName : GfxPartition::heapNonSvmNames) {
         auto &heap = getHeap(heapName);
@@ -315,6 +380,8 @@ bool GfxPartition::init(uint64_t gpuAddressSpace, size_t cpuAddressRangeSizeToRe
     heapInitWithAllocationAlignment(HeapIndex::HEAP_STANDARD2MB, gfxBase + rootDeviceIndex * gfxStandard2MBSize, gfxStandard2MBSize, 2 * MemoryConstants::megaByte);
     DEBUG_BREAK_IF(!isAligned<GfxPartition::heapGranularity2MB>(getHeapBase(HeapIndex::HEAP_STANDARD2MB)));
 
+    initHeapArenas();
+
     return true;
 }
 
@@ -12,7 +12,9 @@
 #include <array>
 
 namespace NEO {
+class ArenaHeapAllocator;
 class HeapAllocator;
+struct ArenaHeapStatistics;
 
 enum class HeapIndex : uint32_t {
     HEAP_INTERNAL_DEVICE_MEMORY = 0u,
@@ -85,6 +87,10 @@ class GfxPartition {
 
     uint64_t getHeapMinimalAddress(HeapIndex heapIndex);
 
+    bool getHeapArenaStatistics(HeapIndex heapIndex, ArenaHeapStatistics &statistics) {
+        return getHeap(heapIndex).getArenaStatistics(statistics);
+    }
+
     bool isLimitedRange() { return getHeap(HeapIndex::HEAP_SVM).getSize() == 0ull; }
 
     static constexpr uint64_t heapGranularity = MemoryConstants::pageSize64k;
@@ -94,8 +100,10 @@ class GfxPartition {
 
     static const std::array<HeapIndex, 4> heap32Names;
     static const std::array<HeapIndex, 8> heapNonSvmNames;
+    static const std::array<HeapIndex, 3> heapStandardNames;
 
   protected:
+    void initHeapArenas();
     bool initAdditionalRange(uint32_t cpuAddressWidth, uint64_t gpuAddressSpace, uint64_t &gfxBase, uint64_t &gfxTop, uint32_t rootDeviceIndex, size_t numRootDevices, uint64_t systemMemorySize);
 
     class Heap {
@@ -111,10 +119,14 @@ class GfxPartition {
         uint64_t allocate(size_t &size);
         uint64_t allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment);
         void free(uint64_t ptr, size_t size);
+        void initArenas(size_t arenaSize, uint32_t numStripes);
+        bool getArenaStatistics(ArenaHeapStatistics &statistics) const;
 
       protected:
         uint64_t base = 0, size = 0;
+        size_t allocationAlignment = MemoryConstants::pageSize;
         std::unique_ptr<HeapAllocator> alloc;
+        std::unique_ptr<ArenaHeapAllocator> arenas;
     };
 
     Heap &getHeap(HeapIndex heapIndex) {
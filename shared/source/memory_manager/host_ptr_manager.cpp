@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -88,11 +88,20 @@ AllocationRequirements HostPtrManager::getAllocationRequirements(uint32_t rootDe
 }
 
 OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequirements &requirements) {
+    FragmentOverlapResults overlapResults;
+    return populateAlreadyAllocatedFragments(requirements, overlapResults);
+}
+
+OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequirements &requirements, FragmentOverlapResults &overlapResults) {
     OsHandleStorage handleStorage;
     for (unsigned int i = 0; i < requirements.requiredFragmentsCount; i++) {
-        OverlapStatus overlapStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
-        FragmentStorage *fragmentStorage = getFragmentAndCheckForOverlaps(requirements.rootDeviceIndex, const_cast<void *>(requirements.allocationFragments[i].allocationPtr),
-                                                                          requirements.allocationFragments[i].allocationSize, overlapStatus);
+        // reuse the lookup done while checking for overlaps, if any
+        if (overlapResults[i].overlapStatus == OverlapStatus::FRAGMENT_NOT_CHECKED) {
+            overlapResults[i].fragment = getFragmentAndCheckForOverlaps(requirements.rootDeviceIndex, requirements.allocationFragments[i].allocationPtr,
+                                                                        requirements.allocationFragments[i].allocationSize, overlapResults[i].overlapStatus);
+        }
+        OverlapStatus overlapStatus = overlapResults[i].overlapStatus;
+        FragmentStorage *fragmentStorage = overlapResults[i].fragment;
         if (overlapStatus == OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT) {
             UNRECOVERABLE_IF(fragmentStorage == nullptr);
             fragmentStorage->refCount++;
@@ -249,8 +258,9 @@ FragmentStorage *HostPtrManager::getFragmentAndCheckForOverlaps(uint32_t rootDev
 OsHandleStorage HostPtrManager::prepareOsStorageForAllocation(MemoryManager &memoryManager, size_t size, const void *ptr, uint32_t rootDeviceIndex) {
     std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
     auto requirements = HostPtrManager::getAllocationRequirements(rootDeviceIndex, ptr, size);
-    UNRECOVERABLE_IF(checkAllocationsForOverlapping(memoryManager, &requirements) == RequirementsStatus::FATAL);
-    auto osStorage = populateAlreadyAllocatedFragments(requirements);
+    FragmentOverlapResults overlapResults;
+    UNRECOVERABLE_IF(checkAllocationsForOverlapping(memoryManager, &requirements, overlapResults) == RequirementsStatus::FATAL);
+    auto osStorage = populateAlreadyAllocatedFragments(requirements, overlapResults);
     if (osStorage.fragmentCount > 0) {
         if (memoryManager.populateOsHandles(osStorage, rootDeviceIndex) != MemoryManager::AllocationStatus::Success) {
             memoryManager.cleanOsHandles(osStorage, rootDeviceIndex);
@@ -261,6 +271,11 @@ OsHandleStorage HostPtrManager::prepareOsStorageForAllocation(MemoryManager &mem
 }
 
 RequirementsStatus HostPtrManager::checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements) {
+    FragmentOverlapResults overlapResults;
+    return checkAllocationsForOverlapping(memoryManager, requirements, overlapResults);
+}
+
+RequirementsStatus HostPtrManager::checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements, FragmentOverlapResults &overlapResults) {
     UNRECOVERABLE_IF(requirements == nullptr);
 
     RequirementsStatus status = RequirementsStatus::SUCCESS;
@@ -268,29 +283,36 @@ RequirementsStatus HostPtrManager::checkAllocationsForOverlapping(MemoryManager
     for (unsigned int i = 0; i < requirements->requiredFragmentsCount; i++) {
         OverlapStatus overlapStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
 
-        getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
-                                       requirements->allocationFragments[i].allocationSize, overlapStatus);
+        auto fragment = getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
+                                                       requirements->allocationFragments[i].allocationSize, overlapStatus);
         if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
+            // cleaning may release fragments found for previous requirements, they have to be looked up again
+            for (unsigned int j = 0; j < i; j++) {
+                overlapResults[j] = {};
+            }
+
             // clean temporary allocations
             memoryManager.cleanTemporaryAllocationListOnAllEngines(false);
 
             // check overlapping again
-            getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
-                                           requirements->allocationFragments[i].allocationSize, overlapStatus);
+            fragment = getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
+                                                      requirements->allocationFragments[i].allocationSize, overlapStatus);
             if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
 
                 // Wait for completion
                 memoryManager.cleanTemporaryAllocationListOnAllEngines(true);
 
                 // check overlapping last time
-                getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
-                                               requirements->allocationFragments[i].allocationSize, overlapStatus);
+                fragment = getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
+                                                          requirements->allocationFragments[i].allocationSize, overlapStatus);
                 if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
                     status = RequirementsStatus::FATAL;
                     break;
                 }
             }
         }
+        overlapResults[i].fragment = fragment;
+        overlapResults[i].overlapStatus = overlapStatus;
     }
     return status;
 }
@@ -6,16 +6,13 @@
  */
 
 #pragma once
+#include "shared/source/memory_manager/host_ptr_defines.h"
+
+#include <array>
 #include <map>
 #include <mutex>
 
 namespace NEO {
-struct AllocationRequirements;
-struct AllocationStorageData;
-struct OsHandleStorage;
-struct FragmentStorage;
-enum class RequirementsStatus;
-
 enum OverlapStatus {
     FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER = 0,
     FRAGMENT_WITHIN_STORED_FRAGMENT,
@@ -35,6 +32,13 @@ struct HostPtrEntryKey {
 };
 
 using HostPtrFragmentsContainer = std::map<HostPtrEntryKey, FragmentStorage>;
+
+struct FragmentOverlapResult {
+    FragmentStorage *fragment = nullptr;
+    OverlapStatus overlapStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
+};
+using FragmentOverlapResults = std::array<FragmentOverlapResult, maxFragmentsCount>;
+
 class MemoryManager;
 class HostPtrManager {
   public:
@@ -49,8 +53,10 @@ class HostPtrManager {
   protected:
     static AllocationRequirements getAllocationRequirements(uint32_t rootDeviceIndex, const void *inputPtr, size_t size);
     OsHandleStorage populateAlreadyAllocatedFragments(AllocationRequirements &requirements);
+    OsHandleStorage populateAlreadyAllocatedFragments(AllocationRequirements &requirements, FragmentOverlapResults &overlapResults);
     FragmentStorage *getFragmentAndCheckForOverlaps(uint32_t rootDeviceIndex, const void *inputPtr, size_t size, OverlapStatus &overlappingStatus);
     RequirementsStatus checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements);
+    RequirementsStatus checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements, FragmentOverlapResults &overlapResults);
 
     HostPtrFragmentsContainer::iterator findElement(HostPtrEntryKey key);
     HostPtrFragmentsContainer partialAllocations;
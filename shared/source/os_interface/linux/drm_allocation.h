@@ -130,6 +130,7 @@ class DrmAllocation : public GraphicsAllocation {
     MOCKABLE_VIRTUAL bool prefetchBO(BufferObject *bo, uint32_t vmHandleId, uint32_t subDeviceId);
     MOCKABLE_VIRTUAL void registerBOBindExtHandle(Drm *drm);
     void freeRegisteredBOBindExtHandles(Drm *drm);
+    const StackVec<uint32_t, 1> &getRegisteredBOBindExtHandles() const { return registeredBoBindHandles; }
     void linkWithRegisteredHandle(uint32_t handle);
     MOCKABLE_VIRTUAL void markForCapture();
     MOCKABLE_VIRTUAL bool shouldAllocationPageFault(const Drm *drm);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,19 +7,24 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_command_stream.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <atomic>
-#include <iostream>
-#include <queue>
 
 namespace NEO {
 
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
+    if (DebugManager.flags.GemCloseWorkerMaxBacklog.get() != -1) {
+        maxBacklog = static_cast<uint32_t>(DebugManager.flags.GemCloseWorkerMaxBacklog.get());
+    }
     thread = Thread::create(worker, reinterpret_cast<void *>(this));
 }
 
@@ -37,14 +42,35 @@ void DrmGemCloseWorker::closeThread() {
 DrmGemCloseWorker::~DrmGemCloseWorker() {
     active = false;
     closeThread();
+    // requests pushed after the worker thread finished its final pass
+    processRequests(queue.detachNodes());
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    auto request = new DrmTeardownRequest;
+    request->bufferObjects.push_back(bo);
+    request->waitForCompletion = true;
+    enqueue(request);
+}
+
+void DrmGemCloseWorker::push(std::unique_ptr<DrmTeardownRequest> request) {
+    if (workCount.load() >= maxBacklog) {
+        // backlog is full, tear down on the calling thread instead of growing the queue
+        workCount++;
+        processRequests(request.release());
+        return;
+    }
+    enqueue(request.release());
+}
+
+void DrmGemCloseWorker::enqueue(DrmTeardownRequest *request) {
     workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+    queue.pushFrontOne(*request);
+    if (workerSleeping.load()) {
+        std::unique_lock<std::mutex> lock(closeWorkerMutex);
+        lock.unlock();
+        condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
@@ -52,6 +78,7 @@ void DrmGemCloseWorker::close(bool blocking) {
     condition.notify_all();
     if (blocking) {
         closeThread();
+        processRequests(queue.detachNodes());
     }
 }
 
@@ -59,46 +86,91 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
-inline void DrmGemCloseWorker::close(BufferObject *bo) {
-    bo->wait(-1);
-    memoryManager.unreference(bo, false);
-    workCount--;
+void DrmGemCloseWorker::unmapRanges(std::vector<std::pair<void *, size_t>> &ranges) {
+    if (ranges.empty()) {
+        return;
+    }
+    std::sort(ranges.begin(), ranges.end());
+
+    auto rangeStart = ranges[0].first;
+    auto rangeSize = ranges[0].second;
+    for (size_t i = 1; i < ranges.size(); i++) {
+        if (ptrOffset(rangeStart, rangeSize) == ranges[i].first) {
+            rangeSize += ranges[i].second;
+            continue;
+        }
+        memoryManager.munmapFunction(rangeStart, rangeSize);
+        rangeStart = ranges[i].first;
+        rangeSize = ranges[i].second;
+    }
+    memoryManager.munmapFunction(rangeStart, rangeSize);
 }
 
-inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
-    BufferObject *workItem = nullptr;
-    while (!inputQueue.empty()) {
-        workItem = inputQueue.front();
-        inputQueue.pop();
-        close(workItem);
+void DrmGemCloseWorker::processRequests(DrmTeardownRequest *requests) {
+    // detached nodes come in LIFO order, restore submission order
+    DrmTeardownRequest *orderedRequests = nullptr;
+    std::vector<std::pair<void *, size_t>> mappedRanges;
+    while (requests) {
+        auto next = requests->next;
+        requests->next = orderedRequests;
+        orderedRequests = requests;
+        if (requests->mmapPtr) {
+            mappedRanges.emplace_back(requests->mmapPtr, requests->mmapSize);
+        }
+        requests = next;
+    }
+
+    unmapRanges(mappedRanges);
+
+    while (orderedRequests) {
+        std::unique_ptr<DrmTeardownRequest> request(orderedRequests);
+        orderedRequests = request->next;
+
+        for (auto bo : request->bufferObjects) {
+            if (bo == nullptr) {
+                continue;
+            }
+            if (request->waitForCompletion) {
+                bo->wait(-1);
+            }
+            memoryManager.unreference(bo, false);
+        }
+        if (request->sharedHandle != Sharing::nonSharedResource) {
+            memoryManager.closeFunction(static_cast<int>(request->sharedHandle));
+        }
+        if (request->reservedAddressPtr) {
+            memoryManager.releaseGpuRange(request->reservedAddressPtr, request->reservedAddressSize, request->rootDeviceIndex);
+        }
+        memoryManager.alignedFreeWrapper(request->driverAllocatedCpuPtr);
+        if (!request->registeredBindHandles.empty()) {
+            auto &drm = memoryManager.getDrm(request->rootDeviceIndex);
+            for (auto it = request->registeredBindHandles.rbegin(); it != request->registeredBindHandles.rend(); ++it) {
+                drm.unregisterResource(*it);
+            }
+        }
+        workCount--;
     }
 }
 
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
 
     while (self->active) {
-        lock.lock();
-
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
+        auto requests = self->queue.detachNodes();
+        if (requests) {
+            self->processRequests(requests);
+            continue;
         }
 
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+        std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
+        self->workerSleeping.store(true);
+        while (self->queue.peekIsEmpty() && self->active) {
+            self->condition.wait(lock);
         }
-
-        lock.unlock();
-        self->processQueue(localQueue);
+        self->workerSleeping.store(false);
     }
 
-    lock.lock();
-    self->processQueue(self->queue);
-
-    lock.unlock();
+    self->processRequests(self->queue.detachNodes());
     self->workerDone.store(true);
     return nullptr;
 }
@@ -1,18 +1,21 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/utilities/iflist.h"
+#include "shared/source/utilities/stackvec.h"
+
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
-#include <set>
+#include <utility>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -24,8 +27,23 @@ enum class gemCloseWorkerMode {
     gemCloseWorkerActive
 };
 
+struct DrmTeardownRequest : IFNode<DrmTeardownRequest> {
+    StackVec<BufferObject *, 4> bufferObjects;
+    void *mmapPtr = nullptr;
+    size_t mmapSize = 0u;
+    void *reservedAddressPtr = nullptr;
+    size_t reservedAddressSize = 0u;
+    void *driverAllocatedCpuPtr = nullptr;
+    StackVec<uint32_t, 1> registeredBindHandles;
+    uint32_t sharedHandle = 0u;
+    uint32_t rootDeviceIndex = 0u;
+    bool waitForCompletion = false;
+};
+
 class DrmGemCloseWorker {
   public:
+    static constexpr uint32_t defaultMaxBacklog = 16384u;
+
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
     MOCKABLE_VIRTUAL ~DrmGemCloseWorker();
 
@@ -33,26 +51,31 @@ class DrmGemCloseWorker {
     DrmGemCloseWorker &operator=(const DrmGemCloseWorker &) = delete;
 
     void push(BufferObject *allocation);
+    void push(std::unique_ptr<DrmTeardownRequest> request);
     MOCKABLE_VIRTUAL void close(bool blocking);
 
     bool isEmpty();
+    bool isActive() const { return active.load(); }
 
   protected:
-    void close(BufferObject *workItem);
+    void enqueue(DrmTeardownRequest *request);
+    void processRequests(DrmTeardownRequest *requests);
+    void unmapRanges(std::vector<std::pair<void *, size_t>> &ranges);
     void closeThread();
-    void processQueue(std::queue<BufferObject *> &inputQueue);
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    IFList<DrmTeardownRequest, true, true> queue;
     std::atomic<uint32_t> workCount{0};
+    uint32_t maxBacklog = defaultMaxBacklog;
 
     DrmMemoryManager &memoryManager;
 
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
+    std::atomic<bool> workerSleeping{false};
     std::atomic<bool> workerDone{false};
 };
 } // namespace NEO
@@ -88,6 +88,10 @@ void DrmMemoryManager::initialize(gemCloseWorkerMode mode) {
         mode = gemCloseWorkerMode::gemCloseWorkerInactive;
     }
 
+    if (DebugManager.flags.EnableDeferredAllocationTeardown.get() == 1) {
+        mode = gemCloseWorkerMode::gemCloseWorkerActive;
+    }
+
     if (DebugManager.flags.EnableGemCloseWorker.get() != -1) {
         mode = DebugManager.flags.EnableGemCloseWorker.get() ? gemCloseWorkerMode::gemCloseWorkerActive : gemCloseWorkerMode::gemCloseWorkerInactive;
     }
@@ -1119,6 +1123,30 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation,
         memoryOperationsInterface->evictWithinOsContext(engine.osContext, *gfxAllocation);
     }
 
+    if (isTeardownDeferrable(drmAlloc, isImported)) {
+        auto request = std::make_unique<DrmTeardownRequest>();
+        request->mmapPtr = drmAlloc->getMmapPtr();
+        request->mmapSize = drmAlloc->getMmapSize();
+        for (auto bo : drmAlloc->getBOs()) {
+            request->bufferObjects.push_back(bo);
+        }
+        request->reservedAddressPtr = gfxAllocation->getReservedAddressPtr();
+        request->reservedAddressSize = gfxAllocation->getReservedAddressSize();
+        request->driverAllocatedCpuPtr = gfxAllocation->getDriverAllocatedCpuPtr();
+        request->registeredBindHandles = drmAlloc->getRegisteredBOBindExtHandles();
+        request->sharedHandle = drmAlloc->peekSharedHandle();
+        request->rootDeviceIndex = rootDeviceIndex;
+
+        // shared handle and bind ext handles are released by the worker after buffer objects, same as below
+        for (auto handleId = 0u; handleId < gfxAllocation->getNumGmms(); handleId++) {
+            delete gfxAllocation->getGmm(handleId);
+        }
+        delete gfxAllocation;
+
+        gemCloseWorker->push(std::move(request));
+        return;
+    }
+
     if (drmAlloc->getMmapPtr()) {
         this->munmapFunction(drmAlloc->getMmapPtr(), drmAlloc->getMmapSize());
     }
@@ -1147,6 +1175,21 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation,
     delete gfxAllocation;
 }
 
+bool DrmMemoryManager::isTeardownDeferrable(DrmAllocation *drmAllocation, bool isImported) const {
+    if (!gemCloseWorker || !gemCloseWorker->isActive() || DebugManager.flags.EnableDeferredAllocationTeardown.get() != 1) {
+        return false;
+    }
+    if (isImported || drmAllocation->fragmentsStorage.fragmentCount) {
+        return false;
+    }
+    for (auto bo : drmAllocation->getBOs()) {
+        if (bo && (bo->peekIsReusableAllocation() || bo->isBoHandleShared())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void DrmMemoryManager::handleFenceCompletion(GraphicsAllocation *allocation) {
     auto &drm = this->getDrm(allocation->getRootDeviceIndex());
     if (drm.isVmBindAvailable()) {
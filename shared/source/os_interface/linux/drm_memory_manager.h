@@ -93,6 +93,8 @@ class DrmMemoryManager : public MemoryManager {
     bool allowIndirectAllocationsAsPack(uint32_t rootDeviceIndex) override;
 
   protected:
+    friend class DrmGemCloseWorker;
+
     void registerSharedBoHandleAllocation(DrmAllocation *drmAllocation);
     BufferObjectHandleWrapper tryToGetBoHandleWrapperWithSharedOwnership(int boHandle);
     void eraseSharedBoHandleWrapper(int boHandle);
@@ -149,6 +151,7 @@ class DrmMemoryManager : public MemoryManager {
     uint32_t getRootDeviceIndex(const Drm *drm);
     BufferObject *createRootDeviceBufferObject(uint32_t rootDeviceIndex);
     void releaseBufferObject(uint32_t rootDeviceIndex);
+    bool isTeardownDeferrable(DrmAllocation *drmAllocation, bool isImported) const;
     bool retrieveMmapOffsetForBufferObject(uint32_t rootDeviceIndex, BufferObject &bo, uint64_t flags, uint64_t &offset);
 
     std::vector<BufferObject *> pinBBs;
@@ -17,7 +17,9 @@
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/os_interface/os_interface.h"
 
 namespace NEO {
 
@@ -43,6 +45,8 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
     auto deviceBitfield = osContext->getDeviceBitfield();
 
     std::lock_guard<std::mutex> lock(mutex);
+    auto drm = this->rootDeviceEnvironment.osInterface->getDriverModel()->as<Drm>();
+
     auto devicesDone = 0u;
     for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
         if (!deviceBitfield.test(drmIterator)) {
@@ -50,6 +54,21 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
         }
         devicesDone++;
 
+        auto batchingVmBinds = gfxAllocations.size() > 1 && drm->beginVmBindBatch();
+        std::vector<DrmAllocation *> batchedAllocations;
+        auto flushVmBindBatch = [&]() {
+            auto ret = drm->flushVmBindBatch(osContext, drmIterator);
+            if (ret) {
+                // batched binds were rolled back, drop the residency of the affected fragments as well
+                for (auto drmAllocation : batchedAllocations) {
+                    for (auto fragmentId = 0u; fragmentId < drmAllocation->fragmentsStorage.fragmentCount; fragmentId++) {
+                        drmAllocation->fragmentsStorage.fragmentStorageData[fragmentId].residency->resident[osContext->getContextId()] = false;
+                    }
+                }
+            }
+            return ret;
+        };
+
         for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
             auto drmAllocation = static_cast<DrmAllocation *>(*gfxAllocation);
             auto bo = drmAllocation->storageInfo.getNumBanks() > 1 ? drmAllocation->getBOs()[drmIterator] : drmAllocation->getBO();
@@ -57,14 +76,29 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
             if (!bo->bindInfo[bo->getOsContextId(osContext)][drmIterator]) {
                 int result = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true);
                 if (result) {
+                    if (batchingVmBinds && flushVmBindBatch()) {
+                        PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "Vm bind batch rolled back after a failed bind\n");
+                    }
                     return MemoryOperationsStatus::OUT_OF_MEMORY;
                 }
+                if (batchingVmBinds) {
+                    batchedAllocations.push_back(drmAllocation);
+                }
             }
 
             if (!evictable) {
                 drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
             }
         }
+
+        if (batchingVmBinds && flushVmBindBatch()) {
+            // batched binds were rolled back, bind one by one to get the evict and retry fallback and a result per buffer object
+            for (auto drmAllocation : batchedAllocations) {
+                if (drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true)) {
+                    return MemoryOperationsStatus::OUT_OF_MEMORY;
+                }
+            }
+        }
     }
 
     return MemoryOperationsStatus::SUCCESS;
@@ -45,10 +45,12 @@
 #include "shared/source/utilities/directory.h"
 
 #include <cstdio>
+#include <csignal>
 #include <cstring>
 #include <fcntl.h>
 #include <fstream>
 #include <map>
+#include <mutex>
 #include <sstream>
 
 namespace NEO {
@@ -60,6 +62,62 @@ Drm::Drm(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceIdIn, RootDeviceEnvironment &r
     fenceVal.fill(0u);
 }
 
+void Drm::initIoctlStatistics() {
+    std::call_once(ioctlStatisticsInitialized, [this]() {
+        this->ioctlStatisticsStorage = std::make_unique<IoctlStatistics>();
+        this->ioctlStatisticsDumpRequestsHandled = ioctlStatisticsDumpRequests.load();
+        this->ioctlStatistics.store(this->ioctlStatisticsStorage.get(), std::memory_order_release);
+
+        auto dumpSignal = DebugManager.flags.IoctlStatisticsDumpSignal.get();
+        if (dumpSignal > 0) {
+            std::lock_guard<std::mutex> lock(ioctlStatisticsDumpSignalMutex);
+            if (ioctlStatisticsDumpSignalUsers == 0) {
+                struct sigaction dumpHandler = {};
+                dumpHandler.sa_sigaction = Drm::ioctlStatisticsDumpSignalHandler;
+                sigemptyset(&dumpHandler.sa_mask);
+                dumpHandler.sa_flags = SA_RESTART | SA_SIGINFO;
+                if (sigaction(dumpSignal, &dumpHandler, &previousIoctlStatisticsDumpSignalAction) != 0) {
+                    return;
+                }
+                ioctlStatisticsDumpSignal = dumpSignal;
+            }
+            ioctlStatisticsDumpSignalUsers++;
+            this->ioctlStatisticsDumpSignalHandlerInstalled = true;
+        }
+    });
+}
+
+void Drm::releaseIoctlStatisticsDumpSignalHandler() {
+    if (!this->ioctlStatisticsDumpSignalHandlerInstalled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(ioctlStatisticsDumpSignalMutex);
+    this->ioctlStatisticsDumpSignalHandlerInstalled = false;
+    if (--ioctlStatisticsDumpSignalUsers == 0) {
+        sigaction(ioctlStatisticsDumpSignal, &previousIoctlStatisticsDumpSignalAction, nullptr);
+    }
+}
+
+std::atomic<uint32_t> Drm::ioctlStatisticsDumpRequests{0};
+std::mutex Drm::ioctlStatisticsDumpSignalMutex;
+uint32_t Drm::ioctlStatisticsDumpSignalUsers = 0;
+int Drm::ioctlStatisticsDumpSignal = 0;
+struct sigaction Drm::previousIoctlStatisticsDumpSignalAction = {};
+
+void Drm::ioctlStatisticsDumpSignalHandler(int signal, siginfo_t *info, void *context) {
+    ioctlStatisticsDumpRequests.fetch_add(1);
+
+    // chain to a handler installed by the application, default and ignore dispositions are overridden
+    auto &previousAction = previousIoctlStatisticsDumpSignalAction;
+    if (previousAction.sa_flags & SA_SIGINFO) {
+        if (previousAction.sa_sigaction != nullptr) {
+            previousAction.sa_sigaction(signal, info, context);
+        }
+    } else if (previousAction.sa_handler != SIG_DFL && previousAction.sa_handler != SIG_IGN) {
+        previousAction.sa_handler(signal);
+    }
+}
+
 SubmissionStatus Drm::getSubmissionStatusFromReturnCode(int32_t retCode) {
     switch (retCode) {
     case 0:
@@ -87,7 +145,7 @@ int Drm::ioctl(DrmIoctl request, void *arg) {
     int returnedErrno = 0;
     SYSTEM_ENTER();
     do {
-        auto measureTime = DebugManager.flags.PrintIoctlTimes.get();
+        auto measureTime = DebugManager.flags.PrintIoctlTimes.get() || DebugManager.flags.EnableIoctlStatistics.get() == 1;
         std::chrono::steady_clock::time_point start;
         std::chrono::steady_clock::time_point end;
 
@@ -98,6 +156,7 @@ int Drm::ioctl(DrmIoctl request, void *arg) {
         }
 
         if (measureTime) {
+            initIoctlStatistics();
             start = std::chrono::steady_clock::now();
         }
         ret = SysCalls::ioctl(getFileDescriptor(), requestValue, arg);
@@ -108,20 +167,13 @@ int Drm::ioctl(DrmIoctl request, void *arg) {
 
         if (measureTime) {
             end = std::chrono::steady_clock::now();
-            long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            auto elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            this->ioctlStatistics.load(std::memory_order_acquire)->record(request, static_cast<uint64_t>(elapsedTime), ret != 0 ? returnedErrno : 0);
 
-            IoctlStatisticsEntry ioctlData{};
-            auto ioctlDataIt = this->ioctlStatistics.find(request);
-            if (ioctlDataIt != this->ioctlStatistics.end()) {
-                ioctlData = ioctlDataIt->second;
+            auto dumpRequests = ioctlStatisticsDumpRequests.load(std::memory_order_relaxed);
+            if (this->ioctlStatisticsDumpRequestsHandled.exchange(dumpRequests) != dumpRequests) {
+                this->printIoctlStatistics();
             }
-
-            ioctlData.totalTime += elapsedTime;
-            ioctlData.count++;
-            ioctlData.minTime = std::min(ioctlData.minTime, elapsedTime);
-            ioctlData.maxTime = std::max(ioctlData.maxTime, elapsedTime);
-
-            this->ioctlStatistics[request] = ioctlData;
         }
 
         if (printIoctl) {
@@ -619,21 +671,50 @@ std::vector<uint8_t> Drm::query(uint32_t queryId, uint32_t queryItemFlags) {
     return data;
 }
 
+bool Drm::getDriverCallStatistics(std::vector<DriverCallStatistics> &statistics) const {
+    auto ioctlStatistics = this->ioctlStatistics.load(std::memory_order_acquire);
+    if (!ioctlStatistics) {
+        return false;
+    }
+
+    statistics.clear();
+    for (size_t request = 0; request < IoctlStatistics::numRequests; request++) {
+        DriverCallStatistics ioctlData{};
+        if (ioctlStatistics->getStatistics(static_cast<DrmIoctl>(request), ioctlData)) {
+            ioctlData.name = getIoctlString(static_cast<DrmIoctl>(request), ioctlHelper.get());
+            statistics.push_back(std::move(ioctlData));
+        }
+    }
+    return true;
+}
+
 void Drm::printIoctlStatistics() {
-    if (!DebugManager.flags.PrintIoctlTimes.get()) {
+    std::vector<DriverCallStatistics> statistics;
+    if (!this->getDriverCallStatistics(statistics)) {
         return;
     }
 
     printf("\n--- Ioctls statistics ---\n");
-    printf("%41s %15s %10s %20s %20s %20s", "Request", "Total time(ns)", "Count", "Avg time per ioctl", "Min", "Max\n");
-    for (const auto &ioctlData : this->ioctlStatistics) {
-        printf("%41s %15llu %10lu %20f %20lld %20lld\n",
-               getIoctlString(ioctlData.first, ioctlHelper.get()).c_str(),
-               ioctlData.second.totalTime,
-               static_cast<unsigned long>(ioctlData.second.count),
-               ioctlData.second.totalTime / static_cast<double>(ioctlData.second.count),
-               ioctlData.second.minTime,
-               ioctlData.second.maxTime);
+    printf("%41s %15s %10s %20s %20s %20s %15s %15s %15s %10s\n", "Request", "Total time(ns)", "Count", "Avg time per ioctl", "Min", "Max", "P50", "P90", "P99", "Errors");
+    for (const auto &ioctlData : statistics) {
+        printf("%41s %15llu %10llu %20f %20llu %20llu %15llu %15llu %15llu %10llu\n",
+               ioctlData.name.c_str(),
+               static_cast<unsigned long long>(ioctlData.totalTime),
+               static_cast<unsigned long long>(ioctlData.count),
+               ioctlData.totalTime / static_cast<double>(ioctlData.count),
+               static_cast<unsigned long long>(ioctlData.minTime),
+               static_cast<unsigned long long>(ioctlData.maxTime),
+               static_cast<unsigned long long>(ioctlData.p50Time),
+               static_cast<unsigned long long>(ioctlData.p90Time),
+               static_cast<unsigned long long>(ioctlData.p99Time),
+               static_cast<unsigned long long>(ioctlData.errorCount));
+        for (const auto &errorCode : ioctlData.errorCodes) {
+            if (errorCode.first == DriverCallStatistics::otherErrorCode) {
+                printf("%41s other errno: %llu\n", "", static_cast<unsigned long long>(errorCode.second));
+                continue;
+            }
+            printf("%41s errno %d(%s): %llu\n", "", errorCode.first, strerror(errorCode.first), static_cast<unsigned long long>(errorCode.second));
+        }
     }
     printf("\n");
 }
@@ -760,7 +841,10 @@ void Drm::cleanup() {
 }
 
 Drm::~Drm() {
-    this->printIoctlStatistics();
+    if (DebugManager.flags.PrintIoctlTimes.get()) {
+        this->printIoctlStatistics();
+    }
+    this->releaseIoctlStatisticsDumpSignalHandler();
 }
 
 int Drm::queryAdapterBDF() {
@@ -1393,7 +1477,8 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
 
         VmBindExtUserFenceT vmBindExtUserFence{};
         bool incrementFenceValue = false;
-        if (ioctlHelper->isWaitBeforeBindRequired(bind)) {
+        bool batchedBind = bind && ioctlHelper->isVmBindBatchOpen();
+        if (!batchedBind && ioctlHelper->isWaitBeforeBindRequired(bind)) {
             if (drm->useVMBindImmediate()) {
                 lock = drm->lockBindFenceMutex();
 
@@ -1424,6 +1509,9 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
                 break;
             }
             drm->setNewResourceBoundToVM(bo, vmHandleId);
+            if (batchedBind && i == 0) {
+                drm->addBatchedVmBind(bo);
+            }
 
         } else {
             vmBind.handle = 0u;
@@ -1458,6 +1546,38 @@ int Drm::unbindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObj
     return changeBufferObjectBinding(this, osContext, vmHandleId, bo, false);
 }
 
+bool Drm::beginVmBindBatch() {
+    return ioctlHelper->beginVmBindBatch();
+}
+
+int Drm::flushVmBindBatch(OsContext *osContext, uint32_t vmHandleId) {
+    // reserve a single fence value for the whole batch, holding the lock until the binds complete keeps the paging fence monotonic
+    auto lock = lockBindFenceMutex();
+    auto osContextLinux = static_cast<OsContextLinux *>(osContext);
+    uint64_t *fenceAddress = getFenceAddr(vmHandleId);
+    uint64_t fenceValue = getNextFenceVal(vmHandleId);
+    if (isPerContextVMRequired()) {
+        fenceAddress = osContextLinux->getFenceAddr(vmHandleId);
+        fenceValue = osContextLinux->getNextFenceVal(vmHandleId);
+    }
+
+    auto ret = ioctlHelper->flushVmBindBatch(castToUint64(fenceAddress), fenceValue);
+    if (ret == 0 && !vmBindBatchBufferObjects.empty()) {
+        if (isPerContextVMRequired()) {
+            osContextLinux->incFenceVal(vmHandleId);
+        } else {
+            incFenceVal(vmHandleId);
+        }
+    }
+    if (ret != 0) {
+        for (auto bo : vmBindBatchBufferObjects) {
+            bo->bindInfo[bo->getOsContextId(osContext)][vmHandleId] = false;
+        }
+    }
+    vmBindBatchBufferObjects.clear();
+    return ret;
+}
+
 int Drm::createDrmVirtualMemory(uint32_t &drmVmId) {
     GemVmControl ctl{};
 
@@ -12,12 +12,15 @@
 #include "shared/source/os_interface/linux/drm_debug.h"
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
+#include "shared/source/os_interface/linux/ioctl_statistics.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "igfxfmid.h"
 
 #include <array>
+#include <atomic>
+#include <csignal>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -131,6 +134,9 @@ class Drm : public DriverModel {
     uint32_t getVirtualMemoryAddressSpace(uint32_t vmId) const;
     MOCKABLE_VIRTUAL int bindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo);
     MOCKABLE_VIRTUAL int unbindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo);
+    bool beginVmBindBatch();
+    MOCKABLE_VIRTUAL int flushVmBindBatch(OsContext *osContext, uint32_t vmHandleId);
+    void addBatchedVmBind(BufferObject *bo) { vmBindBatchBufferObjects.push_back(bo); }
     int setupHardwareInfo(const DeviceDescriptor *, bool);
     void setupSystemInfo(HardwareInfo *hwInfo, SystemInfo *sysInfo);
     void setupCacheInfo(const HardwareInfo &hwInfo);
@@ -139,6 +145,7 @@ class Drm : public DriverModel {
 
     PhysicalDevicePciBusInfo getPciBusInfo() const override;
     bool isGpuHangDetected(OsContext &osContext) override;
+    bool getDriverCallStatistics(std::vector<DriverCallStatistics> &statistics) const override;
 
     bool areNonPersistentContextsSupported() const { return nonPersistentContextsSupported; }
     void checkNonPersistentContextsSupport();
@@ -273,6 +280,9 @@ class Drm : public DriverModel {
     std::string generateUUID();
     std::string generateElfUUID(const void *data);
     void printIoctlStatistics();
+    void initIoctlStatistics();
+    static void ioctlStatisticsDumpSignalHandler(int signal, siginfo_t *info, void *context);
+    void releaseIoctlStatisticsDumpSignalHandler();
     void setupIoctlHelper(const PRODUCT_FAMILY productFamily);
     void queryAndSetVmBindPatIndexProgrammingSupport();
     static std::string getDrmVersion(int fileDescriptor);
@@ -311,17 +321,23 @@ class Drm : public DriverModel {
     ADAPTER_BDF adapterBDF{};
     uint32_t pciDomain = 0;
 
-    struct IoctlStatisticsEntry {
-        long long totalTime = 0;
-        uint64_t count = 0;
-        long long minTime = std::numeric_limits<long long>::max();
-        long long maxTime = 0;
-    };
-    std::unordered_map<DrmIoctl, IoctlStatisticsEntry> ioctlStatistics;
+    std::unique_ptr<IoctlStatistics> ioctlStatisticsStorage;
+    // published after creation, read without ioctlStatisticsInitialized by statistics queries
+    std::atomic<IoctlStatistics *> ioctlStatistics{nullptr};
+    std::once_flag ioctlStatisticsInitialized;
+    std::atomic<uint32_t> ioctlStatisticsDumpRequestsHandled{0};
+    static std::atomic<uint32_t> ioctlStatisticsDumpRequests;
+    bool ioctlStatisticsDumpSignalHandlerInstalled = false;
+    // the handler is shared by all Drm instances, the previous action is restored when the last one is destroyed
+    static std::mutex ioctlStatisticsDumpSignalMutex;
+    static uint32_t ioctlStatisticsDumpSignalUsers;
+    static int ioctlStatisticsDumpSignal;
+    static struct sigaction previousIoctlStatisticsDumpSignalAction;
 
     std::mutex bindFenceMutex;
     std::array<uint64_t, EngineLimits::maxHandleCount> pagingFence;
     std::array<uint64_t, EngineLimits::maxHandleCount> fenceVal;
+    std::vector<BufferObject *> vmBindBatchBufferObjects;
     StackVec<uint32_t, size_t(DrmResourceClass::MaxSize)> classHandles;
     std::vector<uint32_t> virtualMemoryIds;
 
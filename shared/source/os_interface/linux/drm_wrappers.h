@@ -254,6 +254,7 @@ enum class DrmIoctl {
     SyncobjWait,
     SyncobjDestroy,
     Version,
+    Count, // keep last, number of ioctl requests
 };
 
 enum class DrmParam {
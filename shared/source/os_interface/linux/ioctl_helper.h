@@ -106,6 +106,9 @@ class IoctlHelper {
     virtual uint32_t getVmAdviseAtomicAttribute() = 0;
     virtual int vmBind(const VmBindParams &vmBindParams) = 0;
     virtual int vmUnbind(const VmBindParams &vmBindParams) = 0;
+    virtual bool beginVmBindBatch() { return false; }
+    virtual bool isVmBindBatchOpen() { return false; }
+    virtual int flushVmBindBatch(uint64_t fenceAddress, uint64_t fenceValue) { return 0; }
     virtual bool getEuStallProperties(std::array<uint64_t, 12u> &properties, uint64_t dssBufferSize,
                                       uint64_t samplingRate, uint64_t pollPeriod, uint64_t engineInstance, uint64_t notifyNReports) = 0;
     virtual uint32_t getEuStallFdParameter() = 0;
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/ioctl_statistics.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/os_interface/os_interface.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+size_t IoctlStatistics::getLatencyBucket(uint64_t elapsedTime) {
+    if (elapsedTime < 2) {
+        return 0u;
+    }
+    return std::min(static_cast<size_t>(Math::log2(elapsedTime)), numLatencyBuckets - 1);
+}
+
+uint64_t IoctlStatistics::getLatencyBucketUpperBound(size_t bucket) {
+    if (bucket >= numLatencyBuckets - 1) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return (2ull << bucket) - 1;
+}
+
+void IoctlStatistics::record(DrmIoctl request, uint64_t elapsedTime, int returnedErrno) {
+    auto &entry = entries[static_cast<size_t>(request)];
+
+    entry.count.fetch_add(1, std::memory_order_relaxed);
+    entry.totalTime.fetch_add(elapsedTime, std::memory_order_relaxed);
+    entry.latencyHistogram[getLatencyBucket(elapsedTime)].fetch_add(1, std::memory_order_relaxed);
+
+    auto minTime = entry.minTime.load(std::memory_order_relaxed);
+    while (elapsedTime < minTime && !entry.minTime.compare_exchange_weak(minTime, elapsedTime, std::memory_order_relaxed)) {
+    }
+    auto maxTime = entry.maxTime.load(std::memory_order_relaxed);
+    while (elapsedTime > maxTime && !entry.maxTime.compare_exchange_weak(maxTime, elapsedTime, std::memory_order_relaxed)) {
+    }
+
+    if (returnedErrno != 0) {
+        auto errorSlot = static_cast<size_t>(std::clamp(returnedErrno, 0, maxTrackedErrno + 1));
+        entry.errorCodes[errorSlot].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint64_t IoctlStatistics::getPercentile(const std::array<uint64_t, numLatencyBuckets> &histogram, uint64_t count, uint32_t percentile) const {
+    auto threshold = std::max(uint64_t{1}, (count * percentile + 99) / 100);
+    uint64_t accumulated = 0;
+    for (size_t bucket = 0; bucket < numLatencyBuckets; bucket++) {
+        accumulated += histogram[bucket];
+        if (accumulated >= threshold) {
+            return getLatencyBucketUpperBound(bucket);
+        }
+    }
+    return std::numeric_limits<uint64_t>::max();
+}
+
+bool IoctlStatistics::getStatistics(DrmIoctl request, DriverCallStatistics &statistics) const {
+    auto &entry = entries[static_cast<size_t>(request)];
+
+    std::array<uint64_t, numLatencyBuckets> histogram{};
+    uint64_t count = 0;
+    for (size_t bucket = 0; bucket < numLatencyBuckets; bucket++) {
+        histogram[bucket] = entry.latencyHistogram[bucket].load(std::memory_order_relaxed);
+        count += histogram[bucket];
+    }
+    if (count == 0) {
+        return false;
+    }
+
+    statistics.count = count;
+    statistics.totalTime = entry.totalTime.load(std::memory_order_relaxed);
+    statistics.minTime = entry.minTime.load(std::memory_order_relaxed);
+    statistics.maxTime = entry.maxTime.load(std::memory_order_relaxed);
+    statistics.p50Time = std::min(getPercentile(histogram, count, 50), statistics.maxTime);
+    statistics.p90Time = std::min(getPercentile(histogram, count, 90), statistics.maxTime);
+    statistics.p99Time = std::min(getPercentile(histogram, count, 99), statistics.maxTime);
+
+    statistics.errorCount = 0;
+    statistics.errorCodes.clear();
+    for (size_t errorCode = 0; errorCode < entry.errorCodes.size(); errorCode++) {
+        auto occurrences = entry.errorCodes[errorCode].load(std::memory_order_relaxed);
+        if (occurrences > 0) {
+            statistics.errorCount += occurrences;
+            auto reportedErrorCode = errorCode > static_cast<size_t>(maxTrackedErrno) ? DriverCallStatistics::otherErrorCode : static_cast<int>(errorCode);
+            statistics.errorCodes.emplace_back(reportedErrorCode, occurrences);
+        }
+    }
+    return true;
+}
+
+} // namespace NEO
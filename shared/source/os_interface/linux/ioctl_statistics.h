@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/os_interface/linux/drm_wrappers.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace NEO {
+struct DriverCallStatistics;
+
+class IoctlStatistics {
+  public:
+    static constexpr size_t numRequests = static_cast<size_t>(DrmIoctl::Count);
+    static constexpr size_t numLatencyBuckets = 40;
+    static constexpr int maxTrackedErrno = 133;
+
+    void record(DrmIoctl request, uint64_t elapsedTime, int returnedErrno);
+    bool getStatistics(DrmIoctl request, DriverCallStatistics &statistics) const;
+
+    static size_t getLatencyBucket(uint64_t elapsedTime);
+    static uint64_t getLatencyBucketUpperBound(size_t bucket);
+
+  protected:
+    uint64_t getPercentile(const std::array<uint64_t, numLatencyBuckets> &histogram, uint64_t count, uint32_t percentile) const;
+
+    struct Entry {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> totalTime{0};
+        std::atomic<uint64_t> minTime{std::numeric_limits<uint64_t>::max()};
+        std::atomic<uint64_t> maxTime{0};
+        std::array<std::atomic<uint64_t>, numLatencyBuckets> latencyHistogram{};
+        // last slot aggregates errno values above maxTrackedErrno, reported as DriverCallStatistics::otherErrorCode
+        std::array<std::atomic<uint64_t>, maxTrackedErrno + 2> errorCodes{};
+    };
+    std::array<Entry, numRequests> entries;
+};
+
+} // namespace NEO
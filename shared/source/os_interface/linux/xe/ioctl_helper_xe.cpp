@@ -1158,6 +1158,70 @@ int IoctlHelperXe::createDrmContext(Drm &drm, OsContextLinux &osContext, uint32_
     return drmContextId;
 }
 
+bool IoctlHelperXe::isVmBindBatchOpen() {
+    if (!vmBindBatchActive.load()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(vmBindBatchLock);
+    return vmBindBatchOwner == std::this_thread::get_id();
+}
+
+bool IoctlHelperXe::beginVmBindBatch() {
+    if (DebugManager.flags.EnableVmBindBatching.get() != 1) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(vmBindBatchLock);
+    if (vmBindBatchOwner != std::thread::id{}) {
+        return false;
+    }
+    vmBindBatchOwner = std::this_thread::get_id();
+    vmBindBatchActive.store(true);
+    return true;
+}
+
+int IoctlHelperXe::flushVmBindBatch(uint64_t fenceAddress, uint64_t fenceValue) {
+    if (!isVmBindBatchOpen()) {
+        return 0;
+    }
+    int ret = 0;
+    if (!pendingVmBindOps.empty()) {
+        ret = xeSubmitVmBinds(pendingVmBindVmId, pendingVmBindOps, fenceAddress, fenceValue);
+        pendingVmBindOps.clear();
+    }
+
+    std::lock_guard<std::mutex> lock(vmBindBatchLock);
+    vmBindBatchOwner = std::thread::id{};
+    vmBindBatchActive.store(false);
+    return ret;
+}
+
+int IoctlHelperXe::xeSubmitVmBinds(uint32_t vmId, const std::vector<drm_xe_vm_bind_op> &bindOps, uint64_t fenceAddress, uint64_t fenceValue) {
+    struct drm_xe_sync sync[1] = {};
+    sync[0].flags = DRM_XE_SYNC_USER_FENCE | DRM_XE_SYNC_SIGNAL;
+    sync[0].addr = fenceAddress;
+    sync[0].timeline_value = fenceValue;
+
+    struct drm_xe_vm_bind bind = {};
+    bind.vm_id = vmId;
+    bind.num_binds = static_cast<uint32_t>(bindOps.size());
+    if (bindOps.size() == 1) {
+        bind.bind = bindOps[0];
+    } else {
+        bind.vector_of_binds = castToUint64(bindOps.data());
+    }
+    bind.num_syncs = 1;
+    bind.syncs = reinterpret_cast<uintptr_t>(&sync);
+
+    auto ret = IoctlHelper::ioctl(DrmIoctl::GemVmBind, &bind);
+    if (ret != 0) {
+        return ret;
+    }
+
+    return xeWaitUserFence(DRM_XE_UFENCE_WAIT_U64, DRM_XE_UFENCE_WAIT_EQ,
+                           sync[0].addr,
+                           sync[0].timeline_value, NULL, XE_ONE_SEC);
+}
+
 int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool bindOp) {
     int ret = -1;
     const char *operation = "unbind";
@@ -1182,58 +1246,51 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool bindOp) {
         }
     }
     if (found != -1) {
-        uint32_t extraBindFlag = 0;
-        struct drm_xe_sync sync[1] = {};
-        sync[0].flags = DRM_XE_SYNC_USER_FENCE | DRM_XE_SYNC_SIGNAL;
-        extraBindFlag = XE_VM_BIND_FLAG_ASYNC;
-        auto xeBindExtUserFence = reinterpret_cast<UserFenceExtension *>(vmBindParams.extensions);
-        UNRECOVERABLE_IF(!xeBindExtUserFence);
-        UNRECOVERABLE_IF(xeBindExtUserFence->tag != UserFenceExtension::tagValue);
-        sync[0].addr = xeBindExtUserFence->addr;
-        sync[0].timeline_value = xeBindExtUserFence->value;
-
-        struct drm_xe_vm_bind bind = {};
-        bind.vm_id = vmBindParams.vmId;
-        bind.num_binds = 1;
-        bind.bind.obj = vmBindParams.handle;
-        bind.bind.obj_offset = vmBindParams.offset;
-        bind.bind.range = vmBindParams.length;
-        bind.bind.addr = xeDecanonize(vmBindParams.start);
-        bind.bind.op = XE_VM_BIND_OP_MAP;
-        bind.num_syncs = 1;
-        bind.syncs = reinterpret_cast<uintptr_t>(&sync);
+        uint32_t extraBindFlag = XE_VM_BIND_FLAG_ASYNC;
+
+        struct drm_xe_vm_bind_op bindOpInfo = {};
+        bindOpInfo.obj = vmBindParams.handle;
+        bindOpInfo.obj_offset = vmBindParams.offset;
+        bindOpInfo.range = vmBindParams.length;
+        bindOpInfo.addr = xeDecanonize(vmBindParams.start);
+        bindOpInfo.op = XE_VM_BIND_OP_MAP;
         if (vmBindParams.handle & XE_USERPTR_FAKE_FLAG) {
-            bind.bind.obj = 0;
-            bind.bind.obj_offset = bindInfo[found].userptr;
-            bind.bind.op = XE_VM_BIND_OP_MAP_USERPTR;
+            bindOpInfo.obj = 0;
+            bindOpInfo.obj_offset = bindInfo[found].userptr;
+            bindOpInfo.op = XE_VM_BIND_OP_MAP_USERPTR;
         }
         if (!bindOp) {
-            bind.bind.op = XE_VM_BIND_OP_UNMAP;
-            bind.bind.obj = 0;
+            bindOpInfo.op = XE_VM_BIND_OP_UNMAP;
+            bindOpInfo.obj = 0;
             if (bindInfo[found].handle & XE_USERPTR_FAKE_FLAG) {
-                bind.bind.obj_offset = bindInfo[found].userptr;
+                bindOpInfo.obj_offset = bindInfo[found].userptr;
             }
         }
-        bind.bind.op |= extraBindFlag;
+        bindOpInfo.op |= extraBindFlag;
 
-        bindInfo[found].addr = bind.bind.addr;
+        bindInfo[found].addr = bindOpInfo.addr;
         xeLog(" vm=%d obj=0x%x off=0x%llx range=0x%llx addr=0x%llx op=%d(%s) nsy=%d\n",
-              bind.vm_id,
-              bind.bind.obj,
-              bind.bind.obj_offset,
-              bind.bind.range,
-              bind.bind.addr,
-              bind.bind.op,
-              xeGetBindOpName(bind.bind.op),
-              bind.num_syncs);
-        ret = IoctlHelper::ioctl(DrmIoctl::GemVmBind, &bind);
-        if (ret != 0) {
-            return ret;
+              vmBindParams.vmId,
+              bindOpInfo.obj,
+              bindOpInfo.obj_offset,
+              bindOpInfo.range,
+              bindOpInfo.addr,
+              bindOpInfo.op,
+              xeGetBindOpName(bindOpInfo.op),
+              1);
+
+        if (bindOp && isVmBindBatchOpen()) {
+            // the user fence is signaled once for the whole batch on flush
+            UNRECOVERABLE_IF(!pendingVmBindOps.empty() && (pendingVmBindVmId != vmBindParams.vmId));
+            pendingVmBindOps.push_back(bindOpInfo);
+            pendingVmBindVmId = vmBindParams.vmId;
+            return 0;
         }
 
-        return xeWaitUserFence(DRM_XE_UFENCE_WAIT_U64, DRM_XE_UFENCE_WAIT_EQ,
-                               sync[0].addr,
-                               sync[0].timeline_value, NULL, XE_ONE_SEC);
+        auto xeBindExtUserFence = reinterpret_cast<UserFenceExtension *>(vmBindParams.extensions);
+        UNRECOVERABLE_IF(!xeBindExtUserFence);
+        UNRECOVERABLE_IF(xeBindExtUserFence->tag != UserFenceExtension::tagValue);
+        return xeSubmitVmBinds(vmBindParams.vmId, {bindOpInfo}, xeBindExtUserFence->addr, xeBindExtUserFence->value);
     }
 
     xeLog(" -> IoctlHelperXe::%s %s found=%d vmid=0x%x h=0x%x s=0x%llx o=0x%llx l=0x%llx f=0x%llx r=%d\n",
@@ -8,9 +8,12 @@
 #pragma once
 #include "shared/source/os_interface/linux/ioctl_helper.h"
 
+#include <atomic>
 #include <mutex>
+#include <thread>
 
 struct drm_xe_engine_class_instance;
+struct drm_xe_vm_bind_op;
 
 // Arbitratry value for easier identification in the logs for now
 #define XE_NEO_BIND_CAPTURE_FLAG 0x1
@@ -75,6 +78,9 @@ class IoctlHelperXe : public IoctlHelper {
     uint32_t getVmAdviseAtomicAttribute() override;
     int vmBind(const VmBindParams &vmBindParams) override;
     int vmUnbind(const VmBindParams &vmBindParams) override;
+    bool beginVmBindBatch() override;
+    bool isVmBindBatchOpen() override;
+    int flushVmBindBatch(uint64_t fenceAddress, uint64_t fenceValue) override;
     bool getEuStallProperties(std::array<uint64_t, 12u> &properties, uint64_t dssBufferSize, uint64_t samplingRate, uint64_t pollPeriod,
                               uint64_t engineInstance, uint64_t notifyNReports) override;
     uint32_t getEuStallFdParameter() override;
@@ -119,6 +125,7 @@ class IoctlHelperXe : public IoctlHelper {
     std::vector<uint8_t> queryData(uint32_t queryId);
     int xeWaitUserFence(uint64_t mask, uint16_t op, uint64_t addr, uint64_t value, struct drm_xe_engine_class_instance *eci, int64_t timeout);
     int xeVmBind(const VmBindParams &vmBindParams, bool bindOp);
+    int xeSubmitVmBinds(uint32_t vmId, const std::vector<drm_xe_vm_bind_op> &bindOps, uint64_t fenceAddress, uint64_t fenceValue);
 
     struct UserFenceExtension {
         static constexpr uint32_t tagValue = 0x123987;
@@ -144,6 +151,12 @@ class IoctlHelperXe : public IoctlHelper {
     std::vector<uint8_t> topologyFakei915;
     std::vector<drm_xe_engine_class_instance> contextParamEngine;
     std::vector<drm_xe_engine_class_instance> allEngines;
+
+    std::atomic<bool> vmBindBatchActive{false};
+    std::mutex vmBindBatchLock;
+    std::thread::id vmBindBatchOwner{};
+    std::vector<drm_xe_vm_bind_op> pendingVmBindOps;
+    uint32_t pendingVmBindVmId = 0;
 };
 
 } // namespace NEO
@@ -13,6 +13,8 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace NEO {
 struct PhysicalDevicePciBusInfo;
@@ -22,6 +24,22 @@ class ExecutionEnvironment;
 class MemoryManager;
 class OsContext;
 
+struct DriverCallStatistics {
+    // error code reported for failures with errno values which are not tracked individually
+    static constexpr int otherErrorCode = -1;
+
+    std::string name;
+    uint64_t count = 0;
+    uint64_t totalTime = 0;
+    uint64_t minTime = 0;
+    uint64_t maxTime = 0;
+    uint64_t p50Time = 0;
+    uint64_t p90Time = 0;
+    uint64_t p99Time = 0;
+    uint64_t errorCount = 0;
+    std::vector<std::pair<int, uint64_t>> errorCodes;
+};
+
 class HwDeviceId : public NonCopyableClass {
   public:
     HwDeviceId(DriverModelType driverModel) : driverModelType(driverModel) {
@@ -95,6 +113,11 @@ class DriverModel : public NonCopyableClass {
     virtual void cleanup() {}
 
     virtual bool isGpuHangDetected(OsContext &osContext) = 0;
+
+    virtual bool getDriverCallStatistics(std::vector<DriverCallStatistics> &statistics) const {
+        return false;
+    }
+
     const TopologyMap &getTopologyMap() {
         return topologyMap;
     };
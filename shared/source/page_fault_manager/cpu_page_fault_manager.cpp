@@ -8,6 +8,9 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -20,8 +23,14 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::Cpu : AllocationDomain::None;
 
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    pageFaultData.chunkSize = getMigrationChunkSize(size);
+    if (pageFaultData.chunkSize > 0u) {
+        pageFaultData.chunkDomains.assign(Math::divideAndRoundUp(size, pageFaultData.chunkSize), domain);
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -33,9 +42,10 @@ void PageFaultManager::removeAllocation(void *ptr) {
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
-        if (pageFaultData.domain == AllocationDomain::Gpu) {
+        if (pageFaultData.domain == AllocationDomain::Gpu || pageFaultData.chunkSize > 0u) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
-        } else {
+        }
+        if (pageFaultData.domain != AllocationDomain::Gpu) {
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
@@ -71,7 +81,9 @@ void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocs
 }
 
 inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
-    if (pageFaultData.domain == AllocationDomain::Cpu) {
+    if (pageFaultData.domain == AllocationDomain::Cpu && pageFaultData.chunkSize > 0u) {
+        this->migrateChunksToGpuDomain(ptr, pageFaultData);
+    } else if (pageFaultData.domain == AllocationDomain::Cpu) {
         std::chrono::steady_clock::time_point start;
         std::chrono::steady_clock::time_point end;
 
@@ -86,17 +98,24 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
 
         this->protectCPUMemoryAccess(ptr, pageFaultData.size);
     }
+    std::fill(pageFaultData.chunkDomains.begin(), pageFaultData.chunkDomains.end(), AllocationDomain::Gpu);
     pageFaultData.domain = AllocationDomain::Gpu;
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc != this->memoryData.begin()) {
+        --alloc;
+        auto allocPtr = alloc->first;
+        auto &pageFaultData = alloc->second;
+        if (ptr < ptrOffset(allocPtr, pageFaultData.size)) {
             this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
+            if (pageFaultData.chunkSize > 0u) {
+                this->handleChunkPageFault(ptr, allocPtr, pageFaultData);
+            } else {
+                gpuDomainHandler(this, allocPtr, pageFaultData);
+            }
             return true;
         }
     }
@@ -135,6 +154,83 @@ inline void PageFaultManager::migrateStorageToCpuDomain(void *ptr, PageFaultData
     pageFaultData.domain = AllocationDomain::Cpu;
 }
 
+size_t PageFaultManager::getMigrationChunkSize(size_t allocSize) const {
+    if (DebugManager.flags.SharedAllocMigrationChunkSize.get() <= 0 || !this->isChunkedMigrationSupported()) {
+        return 0u;
+    }
+    auto chunkSize = alignUp(static_cast<size_t>(DebugManager.flags.SharedAllocMigrationChunkSize.get()), MemoryConstants::pageSize);
+    return (allocSize > chunkSize) ? chunkSize : 0u;
+}
+
+void PageFaultManager::handleChunkPageFault(void *ptr, void *allocPtr, PageFaultData &pageFaultData) {
+    const auto chunkIndex = ptrDiff(ptr, allocPtr) / pageFaultData.chunkSize;
+    const auto chunkOffset = chunkIndex * pageFaultData.chunkSize;
+    auto chunkPtr = ptrOffset(allocPtr, chunkOffset);
+    const auto chunkSize = std::min(pageFaultData.chunkSize, pageFaultData.size - chunkOffset);
+    const bool unprotectBeforeTransfer = (this->gpuDomainHandler == &PageFaultManager::unprotectAndTransferMemory);
+
+    if (unprotectBeforeTransfer) {
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+    }
+    if (pageFaultData.chunkDomains[chunkIndex] == AllocationDomain::Gpu) {
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+
+        start = std::chrono::steady_clock::now();
+        this->transferToCpu(chunkPtr, chunkSize, pageFaultData.cmdQ);
+        end = std::chrono::steady_clock::now();
+        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferred shared allocation chunk 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(chunkPtr), chunkSize, elapsedTime / 1e3);
+        }
+    }
+    if (!unprotectBeforeTransfer) {
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+    }
+    pageFaultData.chunkDomains[chunkIndex] = AllocationDomain::Cpu;
+
+    if (pageFaultData.domain == AllocationDomain::Gpu) {
+        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(allocPtr);
+    }
+    pageFaultData.domain = AllocationDomain::Cpu;
+}
+
+void PageFaultManager::migrateChunksToGpuDomain(void *allocPtr, PageFaultData &pageFaultData) {
+    std::vector<MemoryRange> dirtyRanges;
+    for (size_t chunkIndex = 0u; chunkIndex < pageFaultData.chunkDomains.size(); chunkIndex++) {
+        auto &chunkDomain = pageFaultData.chunkDomains[chunkIndex];
+        if (chunkDomain == AllocationDomain::Cpu) {
+            const auto chunkOffset = chunkIndex * pageFaultData.chunkSize;
+            const auto chunkSize = std::min(pageFaultData.chunkSize, pageFaultData.size - chunkOffset);
+            if (!dirtyRanges.empty() && ptrOffset(dirtyRanges.back().first, dirtyRanges.back().second) == ptrOffset(allocPtr, chunkOffset)) {
+                dirtyRanges.back().second += chunkSize;
+            } else {
+                dirtyRanges.emplace_back(ptrOffset(allocPtr, chunkOffset), chunkSize);
+            }
+        }
+        chunkDomain = AllocationDomain::Gpu;
+    }
+    if (dirtyRanges.empty()) {
+        return;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+
+    start = std::chrono::steady_clock::now();
+    this->transferRangesToGpu(allocPtr, dirtyRanges, pageFaultData.cmdQ);
+    end = std::chrono::steady_clock::now();
+    long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    for (auto &range : dirtyRanges) {
+        if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferred shared allocation chunk 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(range.first), range.second, elapsedTime / 1e3);
+        }
+        this->protectCPUMemoryAccess(range.first, range.second);
+    }
+}
+
 void PageFaultManager::selectGpuDomainHandler() {
     if (DebugManager.flags.SetCommandStreamReceiver.get() > CommandStreamReceiverType::CSR_HW || DebugManager.flags.NEO_CAL_ENABLED.get()) {
         this->gpuDomainHandler = &PageFaultManager::unprotectAndTransferMemory;
@@ -10,8 +10,10 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace NEO {
 struct MemoryProperties;
@@ -41,8 +43,12 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t chunkSize = 0u;
+        std::vector<AllocationDomain> chunkDomains;
     };
 
+    using MemoryRange = std::pair<void *, size_t>;
+
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
 
     void setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr);
@@ -56,17 +62,22 @@ class PageFaultManager : public NonCopyableOrMovableClass {
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangesToGpu(void *allocPtr, const std::vector<MemoryRange> &ranges, void *cmdQ);
+    MOCKABLE_VIRTUAL bool isChunkedMigrationSupported() const;
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
 
     static void transferAndUnprotectMemory(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     static void unprotectAndTransferMemory(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     void selectGpuDomainHandler();
+    size_t getMigrationChunkSize(size_t allocSize) const;
+    void handleChunkPageFault(void *ptr, void *allocPtr, PageFaultData &pageFaultData);
+    void migrateChunksToGpuDomain(void *allocPtr, PageFaultData &pageFaultData);
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
 
     decltype(&transferAndUnprotectMemory) gpuDomainHandler = &transferAndUnprotectMemory;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    std::map<void *, PageFaultData> memoryData;
     SpinLock mtx;
 };
 } // namespace NEO
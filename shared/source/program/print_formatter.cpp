@@ -22,6 +22,25 @@ PrintFormatter::PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t print
       stringLiteralMap(stringLiteralMap) {
 
     output.reset(new char[maxSinglePrintStringLength]);
+    dataFormat.reset(new char[maxSinglePrintStringLength]);
+}
+
+void PrintFormatter::printKernelOutput() {
+    // records are gathered and written in batches, printToStdout flushes the stream on every call
+    std::string pendingOutput;
+    pendingOutput.reserve(outputFlushThreshold + maxSinglePrintStringLength);
+
+    printKernelOutput([&pendingOutput](char *str) {
+        pendingOutput.append(str);
+        if (pendingOutput.size() >= outputFlushThreshold) {
+            printToStdout(pendingOutput.c_str());
+            pendingOutput.clear();
+        }
+    });
+
+    if (!pendingOutput.empty()) {
+        printToStdout(pendingOutput.c_str());
+    }
 }
 
 void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print) {
@@ -59,7 +78,6 @@ void PrintFormatter::printString(const char *formatString, const std::function<v
     size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
 
     size_t cursor = 0;
-    std::unique_ptr<char[]> dataFormat(new char[length + 1]);
 
     for (size_t i = 0; i <= length; i++) {
         if (formatString[i] == '\\')
@@ -118,6 +136,7 @@ void PrintFormatter::stripVectorTypeConversion(char *format) {
     }
 }
 
+// needsFormatAdjustment<int64_t> is set in the header
 template <>
 void PrintFormatter::adjustFormatString<int64_t>(std::string &formatString) {
     auto longPosition = formatString.find('l');
@@ -16,6 +16,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 
 extern int memcpy_s(void *dst, size_t destSize, const void *src, size_t count); // NOLINT(readability-identifier-naming)
@@ -47,9 +48,11 @@ class PrintFormatter {
   public:
     PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
                    bool using32BitPointers, const StringMap *stringLiteralMap = nullptr);
-    void printKernelOutput(const std::function<void(char *)> &print = [](char *str) { printToStdout(str); });
+    void printKernelOutput();
+    void printKernelOutput(const std::function<void(char *)> &print);
 
     constexpr static size_t maxSinglePrintStringLength = 16 * MemoryConstants::kiloByte;
+    constexpr static size_t outputFlushThreshold = 64 * MemoryConstants::kiloByte;
 
   protected:
     const char *queryPrintfString(uint32_t index) const;
@@ -80,6 +83,10 @@ class PrintFormatter {
         }
     }
 
+    // set for every type that has an adjustFormatString specialization
+    template <class T>
+    static constexpr bool needsFormatAdjustment = false;
+
     template <class T>
     void adjustFormatString(std::string &formatString) {}
 
@@ -88,9 +95,13 @@ class PrintFormatter {
         T value{0};
         read(&value);
         currentOffset = alignUp(currentOffset, sizeof(uint32_t));
-        std::string formatString(inputFormatString);
-        adjustFormatString<T>(formatString);
-        return simpleSprintf(output, size, formatString.c_str(), value);
+        if constexpr (needsFormatAdjustment<T>) {
+            std::string formatString(inputFormatString);
+            adjustFormatString<T>(formatString);
+            return simpleSprintf(output, size, formatString.c_str(), value);
+        } else {
+            return simpleSprintf(output, size, inputFormatString, value);
+        }
     }
 
     template <class T>
@@ -123,6 +134,7 @@ class PrintFormatter {
     }
 
     std::unique_ptr<char[]> output;
+    std::unique_ptr<char[]> dataFormat;
 
     const uint8_t *printfOutputBuffer = nullptr; // buffer extracted from the kernel, contains values to be printed
     uint32_t printfOutputBufferSize = 0;         // size of the data contained in the buffer
@@ -133,4 +145,7 @@ class PrintFormatter {
 
     uint32_t currentOffset = 0; // current position in currently parsed buffer
 };
+
+template <>
+inline constexpr bool PrintFormatter::needsFormatAdjustment<int64_t> = true;
 }; // namespace NEO
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/arena_heap_allocator.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint32_t> nextThreadIndex{0u};
+}
+
+ArenaHeapAllocator::Arena::Arena(uint64_t base, size_t size, size_t allocationAlignment, Stripe &stripe)
+    : base(base), size(size), allocator(std::make_unique<HeapAllocator>(base, size, allocationAlignment)), stripe(stripe) {
+}
+
+ArenaHeapAllocator::ArenaHeapAllocator(HeapAllocator &parentAllocator, size_t arenaSize, size_t allocationAlignment, uint32_t numStripes)
+    : parentAllocator(parentAllocator), arenaSize(arenaSize), allocationAlignment(allocationAlignment) {
+    DEBUG_BREAK_IF(numStripes == 0u);
+    for (uint32_t i = 0; i < numStripes; i++) {
+        stripes.push_back(std::make_unique<Stripe>());
+    }
+}
+
+ArenaHeapAllocator::~ArenaHeapAllocator() {
+    for (auto &arena : arenas) {
+        parentAllocator.free(arena.second->base, arena.second->size);
+    }
+}
+
+size_t ArenaHeapAllocator::getStripeIndex() const {
+    static thread_local uint32_t threadIndex = nextThreadIndex++;
+    return threadIndex % stripes.size();
+}
+
+ArenaHeapAllocator::Arena *ArenaHeapAllocator::findArena(uint64_t ptr) const {
+    std::shared_lock<std::shared_mutex> lock(arenasMutex);
+    auto it = arenas.upper_bound(ptr);
+    if (it == arenas.begin()) {
+        return nullptr;
+    }
+    --it;
+    if (ptr >= it->second->base + it->second->size) {
+        return nullptr;
+    }
+    return it->second.get();
+}
+
+ArenaHeapAllocator::Arena *ArenaHeapAllocator::createArena(Stripe &stripe) {
+    size_t sizeToReserve = arenaSize;
+    auto base = parentAllocator.allocateWithCustomAlignment(sizeToReserve, arenaAlignment);
+    if (base == 0llu) {
+        return nullptr;
+    }
+
+    auto arena = std::make_unique<Arena>(base, sizeToReserve, allocationAlignment, stripe);
+    auto arenaPtr = arena.get();
+
+    std::unique_lock<std::shared_mutex> lock(arenasMutex);
+    arenas.emplace(base, std::move(arena));
+    return arenaPtr;
+}
+
+uint64_t ArenaHeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment) {
+    if (sizeToAllocate > arenaSize / maxAllocationFraction || alignment > arenaAlignment) {
+        bypassedAllocations.fetch_add(1, std::memory_order_relaxed);
+        return 0llu;
+    }
+
+    auto &stripe = *stripes[getStripeIndex()];
+    std::lock_guard<std::mutex> lock(stripe.mtx);
+
+    for (auto it = stripe.arenas.rbegin(); it != stripe.arenas.rend(); it++) {
+        auto ptr = (*it)->allocator->allocateWithCustomAlignment(sizeToAllocate, alignment);
+        if (ptr != 0llu) {
+            arenaAllocations.fetch_add(1, std::memory_order_relaxed);
+            return ptr;
+        }
+    }
+
+    auto arena = createArena(stripe);
+    if (arena == nullptr) {
+        bypassedAllocations.fetch_add(1, std::memory_order_relaxed);
+        return 0llu;
+    }
+    stripe.arenas.push_back(arena);
+
+    auto ptr = arena->allocator->allocateWithCustomAlignment(sizeToAllocate, alignment);
+    if (ptr != 0llu) {
+        arenaAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    return ptr;
+}
+
+bool ArenaHeapAllocator::free(uint64_t ptr, size_t size) {
+    auto arena = findArena(ptr);
+    if (arena == nullptr) {
+        return false;
+    }
+    // arena may be released by another thread once this allocation is gone, read its stripe first
+    auto &stripe = arena->stripe;
+    arena->allocator->free(ptr, size);
+    releaseArenaIfEmpty(arena, stripe);
+    return true;
+}
+
+void ArenaHeapAllocator::releaseArenaIfEmpty(Arena *arena, Stripe &stripe) {
+    std::lock_guard<std::mutex> lock(stripe.mtx);
+    if (stripe.arenas.size() <= 1u) {
+        return;
+    }
+    auto it = std::find(stripe.arenas.begin(), stripe.arenas.end(), arena);
+    if (it == stripe.arenas.end() || arena->allocator->getUsedSize() != 0u) {
+        return;
+    }
+    stripe.arenas.erase(it);
+
+    auto base = arena->base;
+    auto size = arena->size;
+    {
+        std::unique_lock<std::shared_mutex> arenasLock(arenasMutex);
+        arenas.erase(base);
+    }
+    parentAllocator.free(base, size);
+}
+
+void ArenaHeapAllocator::getStatistics(ArenaHeapStatistics &statistics) const {
+    statistics = {};
+    {
+        std::shared_lock<std::shared_mutex> lock(arenasMutex);
+        for (auto &arena : arenas) {
+            statistics.arenaCount++;
+            statistics.reservedSize += arena.second->size;
+            statistics.usedSize += arena.second->allocator->getUsedSize();
+        }
+    }
+    statistics.arenaAllocations = arenaAllocations.load(std::memory_order_relaxed);
+    statistics.bypassedAllocations = bypassedAllocations.load(std::memory_order_relaxed);
+}
+
+} // namespace NEO
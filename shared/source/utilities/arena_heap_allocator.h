@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/constants.h"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+namespace NEO {
+class HeapAllocator;
+
+struct ArenaHeapStatistics {
+    size_t arenaCount = 0u;
+    uint64_t reservedSize = 0u;
+    uint64_t usedSize = 0u;
+    uint64_t arenaAllocations = 0u;
+    uint64_t bypassedAllocations = 0u;
+
+    double getFragmentation() const {
+        return reservedSize ? static_cast<double>(reservedSize - usedSize) / static_cast<double>(reservedSize) : 0.0;
+    }
+};
+
+// Carves large ranges out of a shared HeapAllocator and hands them to per-thread stripes,
+// so small allocations only contend on the stripe of the calling thread.
+// Arenas that become empty are returned to the parent, except the last one of a stripe.
+class ArenaHeapAllocator {
+  public:
+    static constexpr size_t arenaAlignment = 2 * MemoryConstants::megaByte;
+    static constexpr size_t maxAllocationFraction = 8u;
+
+    ArenaHeapAllocator(HeapAllocator &parentAllocator, size_t arenaSize, size_t allocationAlignment, uint32_t numStripes);
+    ~ArenaHeapAllocator();
+
+    ArenaHeapAllocator(const ArenaHeapAllocator &) = delete;
+    ArenaHeapAllocator &operator=(const ArenaHeapAllocator &) = delete;
+
+    // returns 0 when the request should be served by the parent allocator
+    uint64_t allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment);
+    bool free(uint64_t ptr, size_t size);
+
+    void getStatistics(ArenaHeapStatistics &statistics) const;
+
+  protected:
+    struct Stripe;
+
+    struct Arena {
+        Arena(uint64_t base, size_t size, size_t allocationAlignment, Stripe &stripe);
+
+        const uint64_t base;
+        const size_t size;
+        std::unique_ptr<HeapAllocator> allocator;
+        Stripe &stripe;
+    };
+
+    struct Stripe {
+        std::mutex mtx;
+        std::vector<Arena *> arenas;
+    };
+
+    Arena *findArena(uint64_t ptr) const;
+    Arena *createArena(Stripe &stripe);
+    void releaseArenaIfEmpty(Arena *arena, Stripe &stripe);
+    size_t getStripeIndex() const;
+
+    HeapAllocator &parentAllocator;
+    const size_t arenaSize;
+    const size_t allocationAlignment;
+
+    std::vector<std::unique_ptr<Stripe>> stripes;
+
+    mutable std::shared_mutex arenasMutex;
+    std::map<uint64_t, std::unique_ptr<Arena>> arenas;
+
+    std::atomic<uint64_t> arenaAllocations{0u};
+    std::atomic<uint64_t> bypassedAllocations{0u};
+};
+} // namespace NEO
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/chrome_trace_logger.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <fstream>
+#include <iomanip>
+
+namespace NEO {
+
+ChromeTraceLogger &chromeTraceLoggerInstance() {
+    static ChromeTraceLogger chromeTraceLoggerInstance(DebugManager.flags.ChromeTraceFile.get());
+    return chromeTraceLoggerInstance;
+}
+
+ChromeTraceLogger::ChromeTraceLogger(const std::string &filename) {
+    if (filename == "unk") {
+        return;
+    }
+    auto traceFile = std::make_unique<std::ofstream>(filename, std::ios::trunc);
+    if (!traceFile->is_open()) {
+        return;
+    }
+    output = std::move(traceFile);
+    *output << "[";
+}
+
+ChromeTraceLogger::ChromeTraceLogger(std::unique_ptr<std::ostream> &&output) : output(std::move(output)) {
+    if (this->output) {
+        *this->output << "[";
+    }
+}
+
+ChromeTraceLogger::~ChromeTraceLogger() {
+    if (output) {
+        *output << "\n]\n";
+        output->flush();
+    }
+}
+
+void ChromeTraceLogger::writeTimestamp(std::ostream &str, uint64_t timeNs) {
+    // trace event timestamps are expressed in microseconds
+    str << timeNs / 1000 << "." << std::setw(3) << std::setfill('0') << timeNs % 1000 << std::setfill(' ');
+}
+
+void ChromeTraceLogger::writeEscaped(std::ostream &str, const std::string &text) {
+    for (auto character : text) {
+        if (character == '"' || character == '\\') {
+            str << '\\' << character;
+        } else if (static_cast<unsigned char>(character) >= 0x20) {
+            str << character;
+        }
+    }
+}
+
+void ChromeTraceLogger::beginEvent(const std::string &name, char phase, Track track, uint64_t trackId, uint64_t timestampNs) {
+    *output << (firstEvent ? "\n" : ",\n");
+    firstEvent = false;
+
+    *output << "{\"name\":\"";
+    writeEscaped(*output, name);
+    *output << "\",\"cat\":\"" << (track == Track::Gpu ? "gpu" : "host") << "\",\"ph\":\"" << phase
+            << "\",\"pid\":" << static_cast<uint32_t>(track) << ",\"tid\":" << trackId << ",\"ts\":";
+    writeTimestamp(*output, timestampNs);
+}
+
+void ChromeTraceLogger::logSpan(const std::string &name, Track track, uint64_t trackId, uint64_t startNs, uint64_t endNs) {
+    if (!enabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    beginEvent(name, 'X', track, trackId, startNs);
+    *output << ",\"dur\":";
+    writeTimestamp(*output, endNs > startNs ? endNs - startNs : 0u);
+    *output << "}";
+}
+
+void ChromeTraceLogger::logInstant(const std::string &name, Track track, uint64_t trackId, uint64_t timestampNs) {
+    if (!enabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    beginEvent(name, 'i', track, trackId, timestampNs);
+    *output << ",\"s\":\"t\"}";
+}
+
+} // namespace NEO
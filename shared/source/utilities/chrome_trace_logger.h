@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace NEO {
+
+// Streams trace events in Chrome trace event format (JSON array form),
+// readable by chrome://tracing and Perfetto UI.
+// Events are written through as they come, so memory usage does not grow with trace length.
+class ChromeTraceLogger : NonCopyableOrMovableClass {
+  public:
+    enum class Track : uint32_t {
+        Host = 0,
+        Gpu = 1
+    };
+
+    ChromeTraceLogger(const std::string &filename);
+    ChromeTraceLogger(std::unique_ptr<std::ostream> &&output);
+    MOCKABLE_VIRTUAL ~ChromeTraceLogger();
+
+    bool enabled() const {
+        return output != nullptr;
+    }
+
+    void logSpan(const std::string &name, Track track, uint64_t trackId, uint64_t startNs, uint64_t endNs);
+    void logInstant(const std::string &name, Track track, uint64_t trackId, uint64_t timestampNs);
+
+    static void writeTimestamp(std::ostream &str, uint64_t timeNs);
+    static void writeEscaped(std::ostream &str, const std::string &text);
+
+  protected:
+    void beginEvent(const std::string &name, char phase, Track track, uint64_t trackId, uint64_t timestampNs);
+
+    std::mutex mutex;
+    std::unique_ptr<std::ostream> output;
+    bool firstEvent = true;
+};
+
+ChromeTraceLogger &chromeTraceLoggerInstance();
+
+} // namespace NEO
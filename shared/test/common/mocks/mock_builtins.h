@@ -17,6 +17,7 @@
 namespace NEO {
 class MockBuiltins : public BuiltIns {
   public:
+    using BuiltIns::builtinsLib;
     using BuiltIns::perContextSipKernels;
 
     const SipKernel &getSipKernel(SipKernelType type, Device &device) override {
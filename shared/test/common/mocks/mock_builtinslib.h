@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2022 Intel Corporation
+ * Copyright (C) 2021-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,9 +10,15 @@
 #include "shared/source/built_ins/built_ins.h"
 
 using namespace NEO;
-class MockBuiltinsLib : BuiltinsLib {
+class MockBuiltinsLib : public BuiltinsLib {
   public:
     using BuiltinsLib::allStorages;
-    using BuiltinsLib::getBuiltinCode;
     using BuiltinsLib::getBuiltinResource;
+
+    BuiltinCode getBuiltinCode(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device) override {
+        getBuiltinCodeCalled++;
+        return BuiltinsLib::getBuiltinCode(builtin, requestedCodeType, device);
+    }
+
+    uint32_t getBuiltinCodeCalled = 0u;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@ using namespace NEO;
 class MockPageFaultManager : public PageFaultManager {
   public:
     using PageFaultManager::gpuDomainHandler;
+    using PageFaultManager::MemoryRange;
     using PageFaultManager::memoryData;
     using PageFaultManager::PageFaultData;
     using PageFaultManager::PageFaultManager;
@@ -41,6 +42,10 @@ class MockPageFaultManager : public PageFaultManager {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
     }
+    void transferRangesToGpu(void *allocPtr, const std::vector<MemoryRange> &ranges, void *cmdQ) override {
+        transferRangesToGpuCalled++;
+        transferredRangesToGpu.insert(transferredRangesToGpu.end(), ranges.begin(), ranges.end());
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -72,6 +77,8 @@ class MockPageFaultManager : public PageFaultManager {
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
     int moveAllocationToGpuDomainCalled = 0;
+    int transferRangesToGpuCalled = 0;
+    std::vector<MemoryRange> transferredRangesToGpu;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
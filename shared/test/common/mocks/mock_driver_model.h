@@ -13,6 +13,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 namespace NEO {
 
@@ -40,7 +41,14 @@ class MockDriverModel : public NEO::DriverModel {
 
     PhysicalDevicePciSpeedInfo getPciSpeedInfo() const override { return pciSpeedInfo; }
 
+    bool getDriverCallStatistics(std::vector<DriverCallStatistics> &statistics) const override {
+        statistics = driverCallStatistics;
+        return driverCallStatisticsAvailable;
+    }
+
     PhysicalDevicePciSpeedInfo pciSpeedInfo{};
+    std::vector<DriverCallStatistics> driverCallStatistics{};
+    bool driverCallStatisticsAvailable = false;
     PhysicalDevicePciBusInfo pciBusInfo{};
     bool isGpuHangDetectedToReturn{};
     std::function<void()> isGpuHangDetectedSideEffect{};
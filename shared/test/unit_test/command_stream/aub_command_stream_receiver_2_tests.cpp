@@ -842,6 +842,94 @@ HWTEST_F(AubCommandStreamReceiverTests, whenAubCommandStreamReceiverIsCreatedThe
     EXPECT_NE(0u, physicalAddress);
 }
 
+struct MockAubFileStreamWithWriteMemoryCount : public MockAubFileStream {
+    void writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) override {
+        writeMemoryCalled++;
+    }
+    uint32_t writeMemoryCalled = 0u;
+};
+
+HWTEST_F(AubCommandStreamReceiverTests, givenAubDumpSkipUnchangedPagesWhenGpuReadOnlyAllocationIsWrittenAgainThenOnlyChangedPagesAreWritten) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+    pDevice->executionEnvironment->rootDeviceEnvironments[0]->aubCenter.reset(new AubCenter());
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    aubCsr->setupContext(*pDevice->getDefaultEngine().osContext);
+    aubCsr->initializeEngine();
+
+    MockAubFileStreamWithWriteMemoryCount mockStream;
+    aubCsr->stream = &mockStream;
+
+    constexpr size_t size = 2 * MemoryConstants::pageSize;
+    auto memory = alignedMalloc(size, MemoryConstants::pageSize);
+    memset(memory, 0, size);
+    MockGraphicsAllocation allocation(memory, 0x100000, size);
+    allocation.setAllocationType(AllocationType::COMMAND_BUFFER);
+
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_EQ(2u, mockStream.writeMemoryCalled);
+
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_EQ(2u, mockStream.writeMemoryCalled);
+
+    memset(ptrOffset(memory, MemoryConstants::pageSize), 1, MemoryConstants::pageSize);
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_EQ(3u, mockStream.writeMemoryCalled);
+
+    mockStream.pageHashes.clear();
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_EQ(5u, mockStream.writeMemoryCalled);
+
+    alignedFree(memory);
+}
+
+HWTEST_F(AubCommandStreamReceiverTests, givenAubDumpSkipUnchangedPagesWhenGpuWritableAllocationIsRewrittenWithSameContentAfterGpuModifiedItThenAllPagesAreWritten) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+    pDevice->executionEnvironment->rootDeviceEnvironments[0]->aubCenter.reset(new AubCenter());
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    aubCsr->setupContext(*pDevice->getDefaultEngine().osContext);
+    aubCsr->initializeEngine();
+
+    MockAubFileStreamWithWriteMemoryCount mockStream;
+    aubCsr->stream = &mockStream;
+
+    constexpr size_t size = 2 * MemoryConstants::pageSize;
+    auto memory = alignedMalloc(size, MemoryConstants::pageSize);
+    memset(memory, 0, size);
+    MockGraphicsAllocation allocation(memory, 0x100000, size);
+    allocation.setAllocationType(AllocationType::TAG_BUFFER);
+
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_EQ(2u, mockStream.writeMemoryCalled);
+
+    // the GPU modifies the allocation in the simulator, the host then writes the same bytes again
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_EQ(4u, mockStream.writeMemoryCalled);
+    EXPECT_TRUE(mockStream.pageHashes.empty());
+
+    auto entryBits = aubCsr->getPPGTTAdditionalBits(&allocation);
+    aubCsr->writeMemory(0x200000, memory, size, MemoryBanks::MainBank, entryBits);
+    aubCsr->writeMemory(0x200000, memory, size, MemoryBanks::MainBank, entryBits);
+    EXPECT_EQ(8u, mockStream.writeMemoryCalled);
+
+    alignedFree(memory);
+}
+
+HWTEST_F(AubCommandStreamReceiverTests, givenAubFileStreamWhenFileIsReopenedThenWrittenPageHashesAreCleared) {
+    AubMemDump::AubFileStream stream;
+    EXPECT_TRUE(stream.updatePageHash(0x1000, 1u));
+    EXPECT_FALSE(stream.updatePageHash(0x1000, 1u));
+    EXPECT_TRUE(stream.updatePageHash(0x1000, 2u));
+    EXPECT_TRUE(stream.updatePageHash(0x2000, 2u));
+
+    stream.close();
+    EXPECT_TRUE(stream.pageHashes.empty());
+    EXPECT_TRUE(stream.updatePageHash(0x1000, 2u));
+}
+
 HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenEngineIsInitializedThenDumpHandleIsGenerated) {
     MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
     auto &gfxCoreHelper = executionEnvironment.rootDeviceEnvironments[0]->getHelper<GfxCoreHelper>();
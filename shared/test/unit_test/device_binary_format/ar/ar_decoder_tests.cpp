@@ -1,11 +1,13 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
+#include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/helpers/string.h"
 #include "shared/test/common/test_macros/test.h"
 
 using namespace NEO::Ar;
@@ -424,3 +426,96 @@ TEST(ArDecoderDecodeAr, GivenFilesWithLongFilenamesWhenLongNameIsOutOfBoundsThen
     EXPECT_FALSE(decodeErrors.empty());
     EXPECT_STREQ("Corrupt AR archive - long file name entry has broken identifier : '/100            '", decodeErrors.c_str());
 }
+
+TEST(ArDecoderDecodeAr, GivenAliasPointingToMissingFileEntryThenAliasIsSkippedAndWarningIsEmitted) {
+    const uint8_t data[8] = "1234567";
+    const char aliases[] = "b a\nc missing\n";
+    std::vector<uint8_t> arStorage;
+    arStorage.insert(arStorage.end(), reinterpret_cast<const uint8_t *>(arMagic.begin()), reinterpret_cast<const uint8_t *>(arMagic.end()));
+    ArFileEntryHeader fileEntry0;
+    fileEntry0.identifier[0] = 'a';
+    fileEntry0.identifier[1] = '/';
+    fileEntry0.fileSizeInBytes[0] = '8';
+    arStorage.insert(arStorage.end(), reinterpret_cast<const uint8_t *>(&fileEntry0), reinterpret_cast<const uint8_t *>(&fileEntry0 + 1));
+    arStorage.insert(arStorage.end(), data, data + sizeof(data));
+    ArFileEntryHeader aliasesEntry;
+    memcpy_s(aliasesEntry.identifier, sizeof(aliasesEntry.identifier), SpecialFileNames::fileAliasesFile.begin(), SpecialFileNames::fileAliasesFile.size());
+    aliasesEntry.identifier[SpecialFileNames::fileAliasesFile.size()] = '/';
+    aliasesEntry.fileSizeInBytes[0] = '1';
+    aliasesEntry.fileSizeInBytes[1] = '4';
+    arStorage.insert(arStorage.end(), reinterpret_cast<const uint8_t *>(&aliasesEntry), reinterpret_cast<const uint8_t *>(&aliasesEntry + 1));
+    arStorage.insert(arStorage.end(), aliases, aliases + sizeof(aliases) - 1);
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arStorage, decodeErrors, decodeWarnings);
+    EXPECT_NE(nullptr, ar.magic);
+    EXPECT_TRUE(decodeErrors.empty());
+    EXPECT_STREQ("File alias 'c' points to missing file entry 'missing'\n", decodeWarnings.c_str());
+    ASSERT_EQ(2U, ar.files.size());
+    EXPECT_EQ(NEO::ConstStringRef("b"), ar.files[1].fileName);
+    EXPECT_EQ(ar.files[0].fileData.begin(), ar.files[1].fileData.begin());
+    EXPECT_EQ(8U, ar.files[1].fileData.size());
+    EXPECT_EQ(nullptr, ar.files[1].fullHeader);
+}
+
+TEST(ArDecoderFindFileWithPrefix, GivenSmallArchiveThenFilesAreNotIndexedAndFileStoredFirstIsReturned) {
+    const uint8_t fileData[8] = "1234567";
+    const uint8_t otherFileData[8] = "7654321";
+    ArEncoder encoder(false, true);
+    ASSERT_NE(nullptr, encoder.appendFileEntry("64.a", fileData));
+    ASSERT_NE(nullptr, encoder.appendFileEntry("64.b", otherFileData));
+    ASSERT_NE(nullptr, encoder.appendFileEntry("64.c", fileData));
+    auto arData = encoder.encode();
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arData, decodeErrors, decodeWarnings);
+    EXPECT_TRUE(decodeErrors.empty());
+    EXPECT_TRUE(ar.filesIndex.empty());
+
+    auto matched = findFileWithPrefix(ar, "64.");
+    ASSERT_NE(nullptr, matched);
+    EXPECT_EQ(NEO::ConstStringRef("64.a"), matched->fileName);
+
+    matched = findFileWithPrefix(ar, "64.c");
+    ASSERT_NE(nullptr, matched);
+    EXPECT_EQ(NEO::ConstStringRef("64.c"), matched->fileName);
+    EXPECT_EQ(nullptr, matched->fullHeader);
+
+    EXPECT_EQ(nullptr, findFileWithPrefix(ar, "32."));
+}
+
+TEST(ArDecoderFindFileWithPrefix, GivenArchiveWithManyFilesAndAliasesThenIndexIsBuiltOnDecodeAndMatchedEntryKeepsItsOwnName) {
+    const uint8_t fileData[8] = "1234567";
+    ArEncoder encoder(false, true);
+    for (size_t i = 0; i < minFilesCountForIndex; ++i) {
+        auto uniqueData = "unique" + std::to_string(i);
+        ASSERT_NE(nullptr, encoder.appendFileEntry("unk" + std::to_string(i), ArrayRef<const uint8_t>::fromAny(uniqueData.data(), uniqueData.size())));
+    }
+    ASSERT_NE(nullptr, encoder.appendFileEntry("64.target", fileData));
+    ASSERT_NE(nullptr, encoder.appendFileEntry("64.alias", fileData));
+    auto arData = encoder.encode();
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arData, decodeErrors, decodeWarnings);
+    EXPECT_TRUE(decodeErrors.empty());
+    EXPECT_TRUE(decodeWarnings.empty());
+    ASSERT_EQ(minFilesCountForIndex + 2, ar.files.size());
+    EXPECT_EQ(ar.files.size(), ar.filesIndex.size());
+
+    auto matched = findFileWithPrefix(ar, "64.alias");
+    ASSERT_NE(nullptr, matched);
+    EXPECT_EQ(NEO::ConstStringRef("64.alias"), matched->fileName);
+    EXPECT_EQ(nullptr, matched->fullHeader);
+    EXPECT_EQ(ar.files[minFilesCountForIndex].fileData.begin(), matched->fileData.begin());
+
+    matched = findFileWithPrefix(ar, "64.");
+    ASSERT_NE(nullptr, matched);
+    EXPECT_EQ(NEO::ConstStringRef("64.target"), matched->fileName);
+    EXPECT_EQ(&ar.files[minFilesCountForIndex], matched);
+    EXPECT_EQ(NEO::ConstStringRef("64.target/"), NEO::ConstStringRef(matched->fullHeader->identifier, 10));
+
+    EXPECT_EQ(nullptr, findFileWithPrefix(ar, "32."));
+}
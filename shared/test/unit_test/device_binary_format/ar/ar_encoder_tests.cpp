@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/intermediate_representations.h"
+#include "shared/source/device_binary_format/ar/ar_decoder.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
@@ -147,3 +148,43 @@ TEST(ArEncoder, GivenValidTwoFileEntriesWhen8BytePaddingIsRequestedThenPaddingFi
     EXPECT_EQ(0, memcmp(file1Data, data1, sizeof(data1)));
     EXPECT_EQ(0, memcmp(file2Data, data2, sizeof(data2)));
 }
+
+TEST(ArEncoder, GivenDeduplicationDisabledWhenAppendingIdenticalFilesThenEachFileDataIsStored) {
+    const uint8_t fileData[8] = "1234567";
+    ArEncoder encoder;
+    encoder.appendFileEntry("a", fileData);
+    encoder.appendFileEntry("b", fileData);
+
+    auto arData = encoder.encode();
+    EXPECT_EQ(arMagic.size() + 2 * (sizeof(ArFileEntryHeader) + sizeof(fileData)), arData.size());
+}
+
+TEST(ArEncoder, GivenDeduplicationEnabledWhenAppendingIdenticalFilesThenFileDataIsStoredOnceAndAliasIsRecorded) {
+    const uint8_t fileData[8] = "1234567";
+    const uint8_t otherFileData[8] = "7654321";
+    ArEncoder encoder(false, true);
+    EXPECT_NE(nullptr, encoder.appendFileEntry("a", fileData));
+    EXPECT_NE(nullptr, encoder.appendFileEntry("b", otherFileData));
+    auto fileC = encoder.appendFileEntry("c", fileData);
+    ASSERT_NE(nullptr, fileC);
+    EXPECT_EQ(ConstStringRef("c/"), ConstStringRef(fileC->identifier, 2));
+    EXPECT_EQ(ConstStringRef("8 "), ConstStringRef(fileC->fileSizeInBytes, 2));
+
+    auto arData = encoder.encode();
+    ConstStringRef expectedAliases = "c a\n";
+    EXPECT_EQ(arMagic.size() + 3 * sizeof(ArFileEntryHeader) + sizeof(fileData) + sizeof(otherFileData) + expectedAliases.size(), arData.size());
+
+    auto aliasesFile = reinterpret_cast<ArFileEntryHeader *>(arData.data() + arMagic.size() + 2 * (sizeof(ArFileEntryHeader) + sizeof(fileData)));
+    EXPECT_EQ(SpecialFileNames::fileAliasesFile, ConstStringRef(aliasesFile->identifier, SpecialFileNames::fileAliasesFile.size()));
+    EXPECT_EQ(expectedAliases, ConstStringRef(reinterpret_cast<const char *>(aliasesFile + 1), expectedAliases.size()));
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arData, decodeErrors, decodeWarnings);
+    EXPECT_TRUE(decodeErrors.empty());
+    EXPECT_TRUE(decodeWarnings.empty());
+    ASSERT_EQ(3U, ar.files.size());
+    EXPECT_EQ("c", ar.files[2].fileName);
+    EXPECT_EQ(ar.files[0].fileData.begin(), ar.files[2].fileData.begin());
+    EXPECT_EQ(sizeof(fileData), ar.files[2].fileData.size());
+}
@@ -99,6 +99,81 @@ TEST(UnpackSingleDeviceBinaryAr, WhenBinaryWithProductConfigIsFoundThenChooseItA
     EXPECT_EQ(NEO::DeviceBinaryFormat::Patchtokens, unpacked.format);
 }
 
+TEST(UnpackSingleDeviceBinaryAr, GivenDeduplicatedArWhenBinaryWithProductConfigIsAnAliasThenAliasedBinaryIsUsed) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    const auto &compilerProductHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<NEO::CompilerProductHelper>();
+    NEO::HardwareInfo hwInfo = *NEO::defaultHwInfo;
+    NEO::HardwareIpVersion aotConfig = {0};
+    aotConfig.value = compilerProductHelper.getHwIpVersion(hwInfo);
+
+    NEO::Ar::ArEncoder encoder(true, true);
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredProductConfig = ProductConfigHelper::parseMajorMinorRevisionValue(aotConfig);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+
+    ASSERT_TRUE(encoder.appendFileEntry("unk", programTokens.storage));
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProductConfig, programTokens.storage));
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.aotConfig = aotConfig;
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    auto arData = encoder.encode();
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpacked = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Archive>(arData, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
+    EXPECT_EQ(NEO::DeviceBinaryFormat::Patchtokens, unpacked.format);
+
+    auto decodedAr = NEO::Ar::decodeAr(arData, unpackErrors, unpackWarnings);
+    ASSERT_EQ(2U, decodedAr.files.size());
+    EXPECT_EQ(unpacked.deviceBinary.begin(), decodedAr.files[0].fileData.begin());
+    EXPECT_EQ(unpacked.deviceBinary.size(), decodedAr.files[0].fileData.size());
+}
+
+TEST(UnpackSingleDeviceBinaryAr, GivenArWithManyFilesWhenMultipleFilesMatchProductConfigThenFileStoredFirstIsUsed) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    const auto &compilerProductHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<NEO::CompilerProductHelper>();
+    NEO::HardwareInfo hwInfo = *NEO::defaultHwInfo;
+    NEO::HardwareIpVersion aotConfig = {0};
+    aotConfig.value = compilerProductHelper.getHwIpVersion(hwInfo);
+
+    NEO::Ar::ArEncoder encoder;
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredProductConfig = ProductConfigHelper::parseMajorMinorRevisionValue(aotConfig);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+
+    constexpr size_t unknownFilesCount = 40U;
+    for (size_t i = 0; i < unknownFilesCount; ++i) {
+        ASSERT_TRUE(encoder.appendFileEntry("unk" + std::to_string(i), programTokens.storage));
+    }
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProductConfig + "_b", programTokens.storage));
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProductConfig + "_a", programTokens.storage));
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.aotConfig = aotConfig;
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    auto arData = encoder.encode();
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpacked = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Archive>(arData, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
+    EXPECT_EQ(NEO::DeviceBinaryFormat::Patchtokens, unpacked.format);
+
+    auto decodedAr = NEO::Ar::decodeAr(arData, unpackErrors, unpackWarnings);
+    ASSERT_EQ(unknownFilesCount + 2, decodedAr.files.size());
+    EXPECT_EQ(unpacked.packedTargetDeviceBinary.begin(), decodedAr.files[unknownFilesCount].fileData.begin());
+}
+
 TEST(UnpackSingleDeviceBinaryAr, WhenBinaryWithProductConfigIsFoundThenPackedTargetDeviceBinaryIsSet) {
     PatchTokensTestData::ValidEmptyProgram programTokens;
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/blit_helper.h"
 #include "shared/source/helpers/blit_properties.h"
 #include "shared/source/helpers/definitions/command_encoder_args.h"
 #include "shared/test/common/cmd_parse/hw_parse.h"
@@ -138,6 +139,21 @@ TEST(BlitCommandsHelperTest, GivenCopySizeYAndZEqual0WhenConstructingPropertiesF
     EXPECT_EQ(blitProperties.copySize, expectedSize);
 }
 
+TEST(BlitHelperTest, givenDefaultSettingsWhenGettingBcsSplitSubcopySizeThenSizeIsEvenlyDistributed) {
+    EXPECT_EQ(250u, BlitHelper::getBcsSplitSubcopySize(1000, 4));
+    EXPECT_EQ(333u, BlitHelper::getBcsSplitSubcopySize(1000, 3));
+    EXPECT_EQ(1000u, BlitHelper::getBcsSplitSubcopySize(1000, 1));
+}
+
+TEST(BlitHelperTest, givenSubcopyAlignmentSetWhenGettingBcsSplitSubcopySizeThenSizeIsAlignedUpAndLimitedToRemainingSize) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsSubcopyAlignment.set(4);
+
+    EXPECT_EQ(8 * MemoryConstants::kiloByte, BlitHelper::getBcsSplitSubcopySize(30 * MemoryConstants::kiloByte, 4));
+    EXPECT_EQ(4 * MemoryConstants::kiloByte, BlitHelper::getBcsSplitSubcopySize(4 * MemoryConstants::kiloByte, 4));
+    EXPECT_EQ(MemoryConstants::kiloByte, BlitHelper::getBcsSplitSubcopySize(MemoryConstants::kiloByte, 2));
+}
+
 using BlitTests = Test<DeviceFixture>;
 
 HWTEST_F(BlitTests, givenDebugVariablesWhenGettingMaxBlitSizeThenHonorUseProvidedValues) {
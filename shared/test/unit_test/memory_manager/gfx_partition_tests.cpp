@@ -9,7 +9,9 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_memory.h"
+#include "shared/source/utilities/arena_heap_allocator.h"
 #include "shared/source/utilities/cpu_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_gfx_partition.h"
 
@@ -194,6 +196,44 @@ TEST(GfxPartitionTest, GivenLimitedRangeWhenTestingGfxPartitionThenAllExpectatio
     testGfxPartition(gfxPartition, gfxBase, gfxTop, svmTop);
 }
 
+TEST(GfxPartitionTest, givenGpuVaArenasEnabledWhenAllocatingFromStandardHeapThenSmallAllocationIsServedFromArena) {
+    if (is32bit) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableGpuVaArenas.set(1);
+    DebugManager.flags.GpuVaArenaSizeInMb.set(64);
+
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1, false, 0u);
+
+    ArenaHeapStatistics statistics;
+    EXPECT_FALSE(gfxPartition.getHeapArenaStatistics(HeapIndex::HEAP_EXTERNAL, statistics));
+    ASSERT_TRUE(gfxPartition.getHeapArenaStatistics(HeapIndex::HEAP_STANDARD64KB, statistics));
+    EXPECT_EQ(0u, statistics.arenaCount);
+
+    size_t smallSize = MemoryConstants::pageSize64k;
+    auto smallAddress = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD64KB, smallSize);
+    EXPECT_NE(0ull, smallAddress);
+
+    size_t bigSize = 64 * MemoryConstants::megaByte;
+    auto bigAddress = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD64KB, bigSize);
+    EXPECT_NE(0ull, bigAddress);
+
+    gfxPartition.getHeapArenaStatistics(HeapIndex::HEAP_STANDARD64KB, statistics);
+    EXPECT_EQ(1u, statistics.arenaCount);
+    EXPECT_EQ(64 * MemoryConstants::megaByte, statistics.reservedSize);
+    EXPECT_EQ(smallSize, statistics.usedSize);
+    EXPECT_EQ(1u, statistics.arenaAllocations);
+    EXPECT_EQ(1u, statistics.bypassedAllocations);
+
+    gfxPartition.heapFree(HeapIndex::HEAP_STANDARD64KB, smallAddress, smallSize);
+    gfxPartition.heapFree(HeapIndex::HEAP_STANDARD64KB, bigAddress, bigSize);
+
+    gfxPartition.getHeapArenaStatistics(HeapIndex::HEAP_STANDARD64KB, statistics);
+    EXPECT_EQ(0u, statistics.usedSize);
+}
+
 TEST(GfxPartitionTest, GivenUnsupportedGpuRangeThenGfxPartitionIsNotInitialized) {
     if (is32bit) {
         GTEST_SKIP();
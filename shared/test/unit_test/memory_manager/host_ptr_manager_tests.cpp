@@ -471,6 +471,45 @@ TEST_F(HostPtrManagerTest, GivenHostPtrFilledWith3TripleFragmentsWhenAskedForPop
     EXPECT_EQ(0u, hostPtrManager.getFragmentCount());
 }
 
+TEST_F(HostPtrManagerTest, GivenStoredFragmentsWhenCheckingForOverlappingThenOverlapResultsAreReturnedForEachRequiredFragment) {
+    void *cpuPtr = reinterpret_cast<void *>(0x1001);
+    auto size = MemoryConstants::pageSize * 10;
+
+    MockHostPtrManager hostPtrManager;
+    MockMemoryManager memoryManager;
+
+    auto reqs = hostPtrManager.getAllocationRequirements(rootDeviceIndex, cpuPtr, size);
+    ASSERT_EQ(3u, reqs.requiredFragmentsCount);
+
+    FragmentStorage leadingFragment;
+    leadingFragment.fragmentCpuPointer = reqs.allocationFragments[0].allocationPtr;
+    leadingFragment.fragmentSize = reqs.allocationFragments[0].allocationSize;
+    hostPtrManager.storeFragment(rootDeviceIndex, leadingFragment);
+
+    FragmentOverlapResults overlapResults;
+    EXPECT_EQ(RequirementsStatus::SUCCESS, hostPtrManager.checkAllocationsForOverlapping(memoryManager, &reqs, overlapResults));
+
+    EXPECT_EQ(OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT, overlapResults[0].overlapStatus);
+    EXPECT_EQ(hostPtrManager.getFragment({reqs.allocationFragments[0].allocationPtr, rootDeviceIndex}), overlapResults[0].fragment);
+    for (uint32_t i = 1; i < reqs.requiredFragmentsCount; i++) {
+        EXPECT_EQ(OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER, overlapResults[i].overlapStatus);
+        EXPECT_EQ(nullptr, overlapResults[i].fragment);
+    }
+
+    auto osHandles = hostPtrManager.populateAlreadyAllocatedFragments(reqs, overlapResults);
+    EXPECT_EQ(3u, osHandles.fragmentCount);
+    EXPECT_EQ(2, hostPtrManager.getFragment({reqs.allocationFragments[0].allocationPtr, rootDeviceIndex})->refCount);
+    for (uint32_t i = 0; i < reqs.requiredFragmentsCount; i++) {
+        EXPECT_EQ(reqs.allocationFragments[i].allocationPtr, osHandles.fragmentStorageData[i].cpuPtr);
+        EXPECT_EQ(reqs.allocationFragments[i].allocationSize, osHandles.fragmentStorageData[i].fragmentSize);
+    }
+    EXPECT_EQ(1u, hostPtrManager.getFragmentCount());
+
+    hostPtrManager.releaseHostPtr(rootDeviceIndex, leadingFragment.fragmentCpuPointer);
+    hostPtrManager.releaseHostPtr(rootDeviceIndex, leadingFragment.fragmentCpuPointer);
+    EXPECT_EQ(0u, hostPtrManager.getFragmentCount());
+}
+
 TEST_F(HostPtrManagerTest, GivenFragmentSizeZeroWhenGettingFragmentThenNullptrIsReturned) {
     HostPtrManager hostPtrManager;
 
@@ -861,6 +900,28 @@ TEST_F(HostPtrAllocationTest, whenPrepareOsHandlesForAllocationThenPopulateAsMan
     }
 }
 
+TEST_F(HostPtrAllocationTest, givenManyDistinctHostPointersWhenPreparingOsStorageThenEachAllocationGetsItsOwnFragments) {
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+    auto rootDeviceIndex = csr->getRootDeviceIndex();
+
+    constexpr size_t allocationsCount = 256;
+    std::vector<OsHandleStorage> osStorages;
+    osStorages.reserve(allocationsCount);
+
+    for (size_t i = 0; i < allocationsCount; i++) {
+        auto cpuPtr = reinterpret_cast<void *>(0x100010 + i * 4 * MemoryConstants::pageSize);
+        osStorages.push_back(hostPtrManager->prepareOsStorageForAllocation(*memoryManager, 2 * MemoryConstants::pageSize, cpuPtr, rootDeviceIndex));
+        EXPECT_EQ(3u, osStorages.back().fragmentCount);
+    }
+    EXPECT_EQ(3 * allocationsCount, hostPtrManager->getFragmentCount());
+
+    for (auto &osStorage : osStorages) {
+        hostPtrManager->releaseHandleStorage(rootDeviceIndex, osStorage);
+        memoryManager->cleanOsHandles(osStorage, rootDeviceIndex);
+    }
+    EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+}
+
 TEST_F(HostPtrAllocationTest, whenOverlappedFragmentIsBiggerThenStoredAndStoredFragmentIsDestroyedDuringSecondCleaningThenCheckForOverlappingReturnsSuccess) {
 
     void *cpuPtr1 = (void *)0x100004;
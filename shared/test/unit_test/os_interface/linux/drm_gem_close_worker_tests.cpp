@@ -8,6 +8,8 @@
 #include "shared/source/command_stream/device_command_stream.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_command_stream.h"
@@ -15,6 +17,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
 #include "shared/test/common/test_macros/test.h"
@@ -22,6 +25,7 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sched.h>
@@ -36,6 +40,8 @@ class DrmMockForWorker : public Drm {
     std::atomic<int> gemCloseCnt;
     std::atomic<int> gemCloseExpected;
     std::atomic<std::thread::id> ioctlCallerThreadId;
+    std::vector<uint32_t> unregisteredHandles;
+    int gemCloseCntAtUnregister = -1;
     DrmMockForWorker(RootDeviceEnvironment &rootDeviceEnvironment) : Drm(std::make_unique<HwDeviceIdDrm>(mockFd, mockPciPath), rootDeviceEnvironment) {
     }
     int ioctl(DrmIoctl request, void *arg) override {
@@ -46,6 +52,11 @@ class DrmMockForWorker : public Drm {
 
         return 0;
     };
+    void unregisterResource(uint32_t handle) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        gemCloseCntAtUnregister = gemCloseCnt.load();
+        unregisteredHandles.push_back(handle);
+    }
 };
 
 class DrmGemCloseWorkerFixture {
@@ -89,6 +100,8 @@ class DrmGemCloseWorkerFixture {
   protected:
     class DrmAllocationWrapper : public DrmAllocation {
       public:
+        using DrmAllocation::registeredBoBindHandles;
+
         DrmAllocationWrapper(BufferObject *bo)
             : DrmAllocation(0, AllocationType::UNKNOWN, bo, nullptr, 0, static_cast<osHandle>(0u), MemoryPool::MemoryNull) {
         }
@@ -187,3 +200,268 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+namespace {
+std::atomic<uint32_t> munmapCalls{0};
+std::atomic<size_t> munmapBytes{0};
+std::atomic<uint32_t> closeCalls{0};
+std::atomic<int> lastClosedHandle{-1};
+
+int countingMunmap(void *addr, size_t length) noexcept {
+    munmapCalls++;
+    munmapBytes += length;
+    return 0;
+}
+
+int countingClose(int fd) {
+    closeCalls++;
+    lastClosedHandle = fd;
+    return 0;
+}
+} // namespace
+
+struct DrmMemoryManagerWithCountingMunmap : public DrmMemoryManager {
+    DrmMemoryManagerWithCountingMunmap(gemCloseWorkerMode mode, ExecutionEnvironment &executionEnvironment) : DrmMemoryManager(mode, false, false, executionEnvironment) {
+        munmapCalls = 0;
+        munmapBytes = 0;
+        closeCalls = 0;
+        lastClosedHandle = -1;
+        this->munmapFunction = countingMunmap;
+        this->closeFunction = countingClose;
+    }
+};
+
+struct MockDrmGemCloseWorkerForTeardown : DrmGemCloseWorker {
+    using DrmGemCloseWorker::DrmGemCloseWorker;
+    using DrmGemCloseWorker::maxBacklog;
+    using DrmGemCloseWorker::processRequests;
+    using DrmGemCloseWorker::queue;
+};
+
+TEST_F(DrmGemCloseWorkerTests, givenTeardownRequestsWithAdjacentMappingsWhenProcessedTogetherThenMappingsAreUnmappedWithSingleCall) {
+    constexpr size_t numRequests = 64u;
+    constexpr size_t mappingSize = MemoryConstants::pageSize64k;
+    this->drmMock->gemCloseExpected = numRequests;
+
+    DrmMemoryManagerWithCountingMunmap memoryManager(gemCloseWorkerMode::gemCloseWorkerInactive, executionEnvironment);
+    MockDrmGemCloseWorkerForTeardown worker(memoryManager);
+    worker.close(true);
+
+    auto baseAddress = reinterpret_cast<void *>(0x100000000ull);
+    IFList<DrmTeardownRequest, false, false> requests;
+    for (size_t i = 0; i < numRequests; i++) {
+        auto request = new DrmTeardownRequest;
+        // push in reverse order to make sure ranges get sorted before coalescing
+        request->mmapPtr = ptrOffset(baseAddress, (numRequests - 1 - i) * mappingSize);
+        request->mmapSize = mappingSize;
+        request->bufferObjects.push_back(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+        requests.pushFrontOne(*request);
+    }
+
+    worker.processRequests(requests.detachNodes());
+
+    EXPECT_EQ(1u, munmapCalls);
+    EXPECT_EQ(numRequests * mappingSize, munmapBytes);
+    EXPECT_EQ(static_cast<int>(numRequests), this->drmMock->gemCloseCnt.load());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenTeardownRequestsWithDisjointMappingsWhenProcessedTogetherThenEachMappingIsUnmappedSeparately) {
+    this->drmMock->gemCloseExpected = 0;
+
+    DrmMemoryManagerWithCountingMunmap memoryManager(gemCloseWorkerMode::gemCloseWorkerInactive, executionEnvironment);
+    MockDrmGemCloseWorkerForTeardown worker(memoryManager);
+    worker.close(true);
+
+    IFList<DrmTeardownRequest, false, false> requests;
+    for (auto address : {0x100000000ull, 0x100020000ull, 0x100010000ull, 0x100040000ull}) {
+        auto request = new DrmTeardownRequest;
+        request->mmapPtr = reinterpret_cast<void *>(address);
+        request->mmapSize = MemoryConstants::pageSize64k;
+        requests.pushFrontOne(*request);
+    }
+
+    worker.processRequests(requests.detachNodes());
+
+    EXPECT_EQ(2u, munmapCalls);
+    EXPECT_EQ(4 * MemoryConstants::pageSize64k, munmapBytes);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenFullBacklogWhenTeardownRequestIsPushedThenItIsProcessedOnCallingThread) {
+    this->drmMock->gemCloseExpected = 1;
+
+    DrmMemoryManagerWithCountingMunmap memoryManager(gemCloseWorkerMode::gemCloseWorkerInactive, executionEnvironment);
+    MockDrmGemCloseWorkerForTeardown worker(memoryManager);
+    worker.maxBacklog = 0u;
+
+    auto request = std::make_unique<DrmTeardownRequest>();
+    request->mmapPtr = reinterpret_cast<void *>(0x100000000ull);
+    request->mmapSize = MemoryConstants::pageSize;
+    request->bufferObjects.push_back(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+    worker.push(std::move(request));
+
+    EXPECT_TRUE(worker.isEmpty());
+    EXPECT_EQ(1u, munmapCalls);
+    EXPECT_EQ(1, this->drmMock->gemCloseCnt.load());
+    EXPECT_EQ(std::this_thread::get_id(), this->drmMock->ioctlCallerThreadId);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenDebugFlagWhenWorkerIsCreatedThenMaxBacklogIsOverridden) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.GemCloseWorkerMaxBacklog.set(7);
+
+    MockDrmGemCloseWorkerForTeardown worker(*mm);
+    EXPECT_EQ(7u, worker.maxBacklog);
+
+    DebugManager.flags.GemCloseWorkerMaxBacklog.set(-1);
+    MockDrmGemCloseWorkerForTeardown defaultWorker(*mm);
+    EXPECT_EQ(DrmGemCloseWorker::defaultMaxBacklog, defaultWorker.maxBacklog);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenManyThreadsPushingTeardownRequestsWhenQueueIsDrainedThenEveryRequestIsProcessedAndAdjacentMappingsAreUnmappedOnce) {
+    constexpr size_t numThreads = 4u;
+    constexpr size_t numRequestsPerThread = 1024u;
+    constexpr size_t mappingSize = MemoryConstants::pageSize;
+    this->drmMock->gemCloseExpected = numThreads * numRequestsPerThread;
+
+    DrmMemoryManagerWithCountingMunmap memoryManager(gemCloseWorkerMode::gemCloseWorkerInactive, executionEnvironment);
+    MockDrmGemCloseWorkerForTeardown worker(memoryManager);
+    worker.maxBacklog = std::numeric_limits<uint32_t>::max();
+    // stop the worker thread so that all concurrently pushed requests are drained in a single batch
+    worker.close(true);
+
+    auto freeingThread = [&](size_t threadIndex) {
+        auto baseAddress = reinterpret_cast<void *>(0x100000000ull + threadIndex * numRequestsPerThread * mappingSize);
+        for (size_t i = 0; i < numRequestsPerThread; i++) {
+            auto request = std::make_unique<DrmTeardownRequest>();
+            request->mmapPtr = ptrOffset(baseAddress, i * mappingSize);
+            request->mmapSize = mappingSize;
+            request->bufferObjects.push_back(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+            worker.push(std::move(request));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.emplace_back(freeingThread, i);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(worker.isEmpty());
+    EXPECT_EQ(0u, munmapCalls);
+    EXPECT_EQ(0, this->drmMock->gemCloseCnt.load());
+
+    worker.processRequests(worker.queue.detachNodes());
+
+    EXPECT_TRUE(worker.isEmpty());
+    EXPECT_EQ(1u, munmapCalls);
+    EXPECT_EQ(numThreads * numRequestsPerThread * mappingSize, munmapBytes);
+    EXPECT_EQ(static_cast<int>(numThreads * numRequestsPerThread), this->drmMock->gemCloseCnt.load());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenDeferredTeardownEnabledWhenAllocationIsFreedThenBufferObjectIsClosedByWorker) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDeferredAllocationTeardown.set(1);
+    this->drmMock->gemCloseExpected = 1;
+
+    DrmMemoryManagerWithCountingMunmap memoryManager(gemCloseWorkerMode::gemCloseWorkerActive, executionEnvironment);
+    ASSERT_NE(nullptr, memoryManager.peekGemCloseWorker());
+
+    auto bo = new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1);
+    auto allocation = new DrmAllocationWrapper(bo);
+    allocation->setMmapPtr(reinterpret_cast<void *>(0x100000000ull));
+    allocation->setMmapSize(MemoryConstants::pageSize);
+
+    memoryManager.freeGraphicsMemoryImpl(allocation);
+    memoryManager.peekGemCloseWorker()->close(true);
+
+    EXPECT_TRUE(memoryManager.peekGemCloseWorker()->isEmpty());
+    EXPECT_EQ(1u, munmapCalls);
+    EXPECT_EQ(1, this->drmMock->gemCloseCnt.load());
+    EXPECT_NE(std::this_thread::get_id(), this->drmMock->ioctlCallerThreadId);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenDeferredTeardownEnabledWhenAllocationWithSharedAndBindExtHandlesIsFreedThenHandlesAreReleasedByWorkerAfterBufferObject) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDeferredAllocationTeardown.set(1);
+    this->drmMock->gemCloseExpected = 1;
+
+    DrmMemoryManagerWithCountingMunmap memoryManager(gemCloseWorkerMode::gemCloseWorkerActive, executionEnvironment);
+    ASSERT_NE(nullptr, memoryManager.peekGemCloseWorker());
+
+    auto bo = new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1);
+    auto allocation = new DrmAllocationWrapper(bo);
+    allocation->setSharedHandle(7u);
+    allocation->registeredBoBindHandles.push_back(1u);
+    allocation->registeredBoBindHandles.push_back(2u);
+
+    memoryManager.freeGraphicsMemoryImpl(allocation);
+    memoryManager.peekGemCloseWorker()->close(true);
+
+    EXPECT_EQ(1, this->drmMock->gemCloseCnt.load());
+    EXPECT_EQ(1u, closeCalls);
+    EXPECT_EQ(7, lastClosedHandle);
+    std::vector<uint32_t> expectedUnregisteredHandles = {2u, 1u};
+    EXPECT_EQ(expectedUnregisteredHandles, this->drmMock->unregisteredHandles);
+    EXPECT_EQ(1, this->drmMock->gemCloseCntAtUnregister);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenDeferredTeardownEnabledAndClosedWorkerWhenAllocationIsFreedThenBufferObjectIsClosedOnCallingThread) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDeferredAllocationTeardown.set(1);
+    this->drmMock->gemCloseExpected = 1;
+
+    DrmMemoryManagerWithCountingMunmap memoryManager(gemCloseWorkerMode::gemCloseWorkerActive, executionEnvironment);
+    ASSERT_NE(nullptr, memoryManager.peekGemCloseWorker());
+    memoryManager.peekGemCloseWorker()->close(true);
+    EXPECT_FALSE(memoryManager.peekGemCloseWorker()->isActive());
+
+    auto bo = new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1);
+    auto allocation = new DrmAllocationWrapper(bo);
+    allocation->setMmapPtr(reinterpret_cast<void *>(0x100000000ull));
+    allocation->setMmapSize(MemoryConstants::pageSize);
+
+    memoryManager.freeGraphicsMemoryImpl(allocation);
+
+    EXPECT_TRUE(memoryManager.peekGemCloseWorker()->isEmpty());
+    EXPECT_EQ(1u, munmapCalls);
+    EXPECT_EQ(1, this->drmMock->gemCloseCnt.load());
+    EXPECT_EQ(std::this_thread::get_id(), this->drmMock->ioctlCallerThreadId);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenTeardownRequestPushedAfterWorkerThreadFinishedWhenWorkerIsDestroyedThenRequestIsProcessed) {
+    this->drmMock->gemCloseExpected = 1;
+
+    DrmMemoryManagerWithCountingMunmap memoryManager(gemCloseWorkerMode::gemCloseWorkerInactive, executionEnvironment);
+    auto worker = std::make_unique<MockDrmGemCloseWorkerForTeardown>(memoryManager);
+    worker->close(true);
+
+    auto request = std::make_unique<DrmTeardownRequest>();
+    request->mmapPtr = reinterpret_cast<void *>(0x100000000ull);
+    request->mmapSize = MemoryConstants::pageSize;
+    request->bufferObjects.push_back(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+    worker->push(std::move(request));
+
+    EXPECT_FALSE(worker->isEmpty());
+    EXPECT_EQ(0, this->drmMock->gemCloseCnt.load());
+
+    worker.reset();
+
+    EXPECT_EQ(1u, munmapCalls);
+    EXPECT_EQ(1, this->drmMock->gemCloseCnt.load());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenDeferredTeardownDisabledWhenAllocationIsFreedThenBufferObjectIsClosedOnCallingThread) {
+    this->drmMock->gemCloseExpected = 1;
+
+    DrmMemoryManagerWithCountingMunmap memoryManager(gemCloseWorkerMode::gemCloseWorkerActive, executionEnvironment);
+
+    auto bo = new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1);
+    auto allocation = new DrmAllocationWrapper(bo);
+
+    memoryManager.freeGraphicsMemoryImpl(allocation);
+
+    EXPECT_EQ(1, this->drmMock->gemCloseCnt.load());
+    EXPECT_EQ(std::this_thread::get_id(), this->drmMock->ioctlCallerThreadId);
+}
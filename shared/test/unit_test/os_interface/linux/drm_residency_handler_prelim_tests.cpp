@@ -15,6 +15,7 @@
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_bind.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_default.h"
+#include "shared/source/os_interface/linux/ioctl_helper.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
@@ -33,6 +34,7 @@
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture_prelim.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include <limits>
 #include <memory>
 
 using namespace NEO;
@@ -637,6 +639,161 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, whenMakeResidentTwiceThenAllocIsBound
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+struct MockIoctlHelperVmBindBatch : public IoctlHelperPrelim20 {
+    using IoctlHelperPrelim20::IoctlHelperPrelim20;
+
+    bool beginVmBindBatch() override {
+        batchOpen = true;
+        return true;
+    }
+    bool isVmBindBatchOpen() override {
+        return batchOpen;
+    }
+    int vmBind(const VmBindParams &vmBindParams) override {
+        if (batchOpen) {
+            if (batchedVmBinds >= batchedVmBindsBeforeFailure) {
+                return -1;
+            }
+            batchedVmBinds++;
+            return 0;
+        }
+        return IoctlHelperPrelim20::vmBind(vmBindParams);
+    }
+    int flushVmBindBatch(uint64_t fenceAddress, uint64_t fenceValue) override {
+        batchOpen = false;
+        flushedFenceValues.push_back(fenceValue);
+        return flushVmBindBatchResult;
+    }
+
+    bool batchOpen = false;
+    uint32_t batchedVmBinds = 0u;
+    uint32_t batchedVmBindsBeforeFailure = std::numeric_limits<uint32_t>::max();
+    std::vector<uint64_t> flushedFenceValues;
+    int flushVmBindBatchResult = 0;
+};
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchWhenMakingAllocationsResidentThenBindsAreFlushedOncePerVmWithSingleFenceValue) {
+    auto ioctlHelper = new MockIoctlHelperVmBindBatch(*mock);
+    mock->ioctlHelper.reset(ioctlHelper);
+
+    GraphicsAllocation *allocations[3];
+    for (auto &allocation : allocations) {
+        allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    }
+    auto osContext = device->getDefaultEngine().osContext;
+    auto deviceBitfield = osContext->getDeviceBitfield();
+
+    std::vector<uint64_t> expectedFenceValues;
+    for (auto vmHandleId = 0u; vmHandleId < deviceBitfield.size(); vmHandleId++) {
+        if (deviceBitfield.test(vmHandleId)) {
+            expectedFenceValues.push_back(mock->getNextFenceVal(vmHandleId));
+        }
+    }
+
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(allocations), false));
+    EXPECT_EQ(0u, mock->context.vmBindCalled);
+    EXPECT_EQ(3u * deviceBitfield.count(), ioctlHelper->batchedVmBinds);
+    EXPECT_EQ(expectedFenceValues, ioctlHelper->flushedFenceValues);
+
+    for (auto vmHandleId = 0u, i = 0u; vmHandleId < deviceBitfield.size(); vmHandleId++) {
+        if (deviceBitfield.test(vmHandleId)) {
+            EXPECT_EQ(expectedFenceValues[i++] + 1, mock->getNextFenceVal(vmHandleId));
+        }
+    }
+
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(allocations), false));
+    EXPECT_EQ(3u * deviceBitfield.count(), ioctlHelper->batchedVmBinds);
+    for (auto vmHandleId = 0u, i = 0u; vmHandleId < deviceBitfield.size(); vmHandleId++) {
+        if (deviceBitfield.test(vmHandleId)) {
+            EXPECT_EQ(expectedFenceValues[i++] + 1, mock->getNextFenceVal(vmHandleId));
+        }
+    }
+
+    for (auto &allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchFlushFailsWhenMakingAllocationsResidentThenAllocationsAreBoundOneByOne) {
+    auto ioctlHelper = new MockIoctlHelperVmBindBatch(*mock);
+    ioctlHelper->flushVmBindBatchResult = -1;
+    mock->ioctlHelper.reset(ioctlHelper);
+    operationHandler->useBaseEvictUnused = false;
+
+    GraphicsAllocation *allocations[3];
+    for (auto &allocation : allocations) {
+        allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    }
+    auto osContext = device->getDefaultEngine().osContext;
+    auto deviceBitfield = osContext->getDeviceBitfield();
+
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(allocations), false));
+    EXPECT_EQ(3u * deviceBitfield.count(), ioctlHelper->batchedVmBinds);
+    EXPECT_EQ(3u * deviceBitfield.count(), mock->context.vmBindCalled);
+    EXPECT_EQ(0u, operationHandler->evictUnusedCalled);
+
+    for (auto allocation : allocations) {
+        auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+        for (auto vmHandleId = 0u; vmHandleId < deviceBitfield.size(); vmHandleId++) {
+            EXPECT_EQ(deviceBitfield.test(vmHandleId), bo->bindInfo[bo->getOsContextId(osContext)][vmHandleId]);
+        }
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchFlushAndRetriedBindsFailWhenMakingAllocationsResidentThenOutOfMemoryIsReturnedAndNothingIsMarkedAsBound) {
+    auto ioctlHelper = new MockIoctlHelperVmBindBatch(*mock);
+    ioctlHelper->flushVmBindBatchResult = -1;
+    mock->ioctlHelper.reset(ioctlHelper);
+    mock->context.vmBindReturn = -1;
+    operationHandler->useBaseEvictUnused = false;
+
+    GraphicsAllocation *allocations[3];
+    for (auto &allocation : allocations) {
+        allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    }
+    auto osContext = device->getDefaultEngine().osContext;
+
+    EXPECT_EQ(MemoryOperationsStatus::OUT_OF_MEMORY, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(allocations), false));
+    EXPECT_EQ(1u, operationHandler->evictUnusedCalled);
+
+    mock->context.vmBindReturn = 0;
+    for (auto allocation : allocations) {
+        auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+        for (auto vmHandleId = 0u; vmHandleId < osContext->getDeviceBitfield().size(); vmHandleId++) {
+            EXPECT_FALSE(bo->bindInfo[bo->getOsContextId(osContext)][vmHandleId]);
+        }
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchWhenBindFailsMidBatchAndFlushFailsThenOutOfMemoryIsReturnedAndBatchedAllocationsAreNotMarkedAsBound) {
+    auto ioctlHelper = new MockIoctlHelperVmBindBatch(*mock);
+    ioctlHelper->flushVmBindBatchResult = -1;
+    ioctlHelper->batchedVmBindsBeforeFailure = 1u;
+    mock->ioctlHelper.reset(ioctlHelper);
+    operationHandler->useBaseEvictUnused = false;
+
+    GraphicsAllocation *allocations[3];
+    for (auto &allocation : allocations) {
+        allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    }
+    auto osContext = device->getDefaultEngine().osContext;
+
+    EXPECT_EQ(MemoryOperationsStatus::OUT_OF_MEMORY, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(allocations), false));
+    EXPECT_EQ(1u, ioctlHelper->batchedVmBinds);
+    EXPECT_EQ(1u, ioctlHelper->flushedFenceValues.size());
+    EXPECT_FALSE(ioctlHelper->batchOpen);
+
+    for (auto allocation : allocations) {
+        auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+        for (auto vmHandleId = 0u; vmHandleId < osContext->getDeviceBitfield().size(); vmHandleId++) {
+            EXPECT_FALSE(bo->bindInfo[bo->getOsContextId(osContext)][vmHandleId]);
+        }
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, WhenVmBindAvaialableThenMemoryManagerReturnsSupportForIndirectAllocationsAsPack) {
     mock->bindAvailable = true;
     EXPECT_TRUE(memoryManager->allowIndirectAllocationsAsPack(0u));
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/ioctl_statistics.h"
+#include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(IoctlStatisticsTest, whenGettingLatencyBucketThenLog2OfElapsedTimeIsReturned) {
+    EXPECT_EQ(0u, IoctlStatistics::getLatencyBucket(0));
+    EXPECT_EQ(0u, IoctlStatistics::getLatencyBucket(1));
+    EXPECT_EQ(1u, IoctlStatistics::getLatencyBucket(2));
+    EXPECT_EQ(1u, IoctlStatistics::getLatencyBucket(3));
+    EXPECT_EQ(10u, IoctlStatistics::getLatencyBucket(1024));
+    EXPECT_EQ(IoctlStatistics::numLatencyBuckets - 1, IoctlStatistics::getLatencyBucket(std::numeric_limits<uint64_t>::max()));
+
+    EXPECT_EQ(1u, IoctlStatistics::getLatencyBucketUpperBound(0));
+    EXPECT_EQ(2047u, IoctlStatistics::getLatencyBucketUpperBound(10));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), IoctlStatistics::getLatencyBucketUpperBound(IoctlStatistics::numLatencyBuckets - 1));
+}
+
+TEST(IoctlStatisticsTest, givenNoRecordedCallsWhenGettingStatisticsThenFalseIsReturned) {
+    auto ioctlStatistics = std::make_unique<IoctlStatistics>();
+    DriverCallStatistics statistics{};
+    EXPECT_FALSE(ioctlStatistics->getStatistics(DrmIoctl::GemCreate, statistics));
+}
+
+TEST(IoctlStatisticsTest, givenRecordedCallsWhenGettingStatisticsThenCountsLatenciesAndPercentilesAreReturned) {
+    auto ioctlStatistics = std::make_unique<IoctlStatistics>();
+    for (uint64_t i = 0; i < 98; i++) {
+        ioctlStatistics->record(DrmIoctl::GemCreate, 1000, 0);
+    }
+    ioctlStatistics->record(DrmIoctl::GemCreate, 100000, 0);
+    ioctlStatistics->record(DrmIoctl::GemCreate, 500, 0);
+    ioctlStatistics->record(DrmIoctl::GemClose, 10, 0);
+
+    DriverCallStatistics statistics{};
+    ASSERT_TRUE(ioctlStatistics->getStatistics(DrmIoctl::GemCreate, statistics));
+    EXPECT_EQ(100u, statistics.count);
+    EXPECT_EQ(98u * 1000u + 100000u + 500u, statistics.totalTime);
+    EXPECT_EQ(500u, statistics.minTime);
+    EXPECT_EQ(100000u, statistics.maxTime);
+    EXPECT_EQ(1023u, statistics.p50Time);
+    EXPECT_EQ(1023u, statistics.p90Time);
+    EXPECT_EQ(1023u, statistics.p99Time);
+    EXPECT_EQ(0u, statistics.errorCount);
+    EXPECT_TRUE(statistics.errorCodes.empty());
+
+    ioctlStatistics->record(DrmIoctl::GemCreate, 100000, 0);
+    ASSERT_TRUE(ioctlStatistics->getStatistics(DrmIoctl::GemCreate, statistics));
+    EXPECT_EQ(100000u, statistics.p99Time);
+
+    ASSERT_TRUE(ioctlStatistics->getStatistics(DrmIoctl::GemClose, statistics));
+    EXPECT_EQ(1u, statistics.count);
+    EXPECT_EQ(10u, statistics.p50Time);
+}
+
+TEST(IoctlStatisticsTest, givenFailedCallsWhenGettingStatisticsThenErrnoBreakdownIsReturned) {
+    auto ioctlStatistics = std::make_unique<IoctlStatistics>();
+    ioctlStatistics->record(DrmIoctl::GemExecbuffer2, 10, EBUSY);
+    ioctlStatistics->record(DrmIoctl::GemExecbuffer2, 10, EBUSY);
+    ioctlStatistics->record(DrmIoctl::GemExecbuffer2, 10, ENOMEM);
+    ioctlStatistics->record(DrmIoctl::GemExecbuffer2, 10, IoctlStatistics::maxTrackedErrno + 100);
+    ioctlStatistics->record(DrmIoctl::GemExecbuffer2, 10, 0);
+
+    DriverCallStatistics statistics{};
+    ASSERT_TRUE(ioctlStatistics->getStatistics(DrmIoctl::GemExecbuffer2, statistics));
+    EXPECT_EQ(5u, statistics.count);
+    EXPECT_EQ(4u, statistics.errorCount);
+
+    std::vector<std::pair<int, uint64_t>> expectedErrorCodes = {{ENOMEM, 1u}, {EBUSY, 2u}, {DriverCallStatistics::otherErrorCode, 1u}};
+    EXPECT_EQ(expectedErrorCodes, statistics.errorCodes);
+}
+
+TEST(IoctlStatisticsTest, givenConcurrentRecordsWhenGettingStatisticsThenNoCallIsLost) {
+    auto ioctlStatistics = std::make_unique<IoctlStatistics>();
+    constexpr uint32_t numThreads = 4u;
+    constexpr uint32_t callsPerThread = 1000u;
+
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < numThreads; thread++) {
+        threads.emplace_back([&ioctlStatistics, thread]() {
+            for (uint32_t call = 0; call < callsPerThread; call++) {
+                ioctlStatistics->record(DrmIoctl::GemWait, thread + 1, 0);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    DriverCallStatistics statistics{};
+    ASSERT_TRUE(ioctlStatistics->getStatistics(DrmIoctl::GemWait, statistics));
+    EXPECT_EQ(numThreads * callsPerThread, statistics.count);
+    EXPECT_EQ(1u, statistics.minTime);
+    EXPECT_EQ(numThreads, statistics.maxTime);
+}
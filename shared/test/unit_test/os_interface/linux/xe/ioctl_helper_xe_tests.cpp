@@ -600,6 +600,12 @@ class DrmMockXe : public DrmMockCustom {
             ret = gemVmBindReturn;
             auto vmBindInput = static_cast<drm_xe_vm_bind *>(arg);
             vmBindInputs.push_back(*vmBindInput);
+            if (vmBindInput->num_binds > 1) {
+                auto bindOps = reinterpret_cast<drm_xe_vm_bind_op *>(vmBindInput->vector_of_binds);
+                vmBindOpInputs.insert(vmBindOpInputs.end(), bindOps, bindOps + vmBindInput->num_binds);
+            } else {
+                vmBindOpInputs.push_back(vmBindInput->bind);
+            }
 
             EXPECT_EQ(1u, vmBindInput->num_syncs);
 
@@ -640,6 +646,7 @@ class DrmMockXe : public DrmMockCustom {
 
     StackVec<drm_xe_wait_user_fence, 1> waitUserFenceInputs;
     StackVec<drm_xe_vm_bind, 1> vmBindInputs;
+    std::vector<drm_xe_vm_bind_op> vmBindOpInputs;
     StackVec<drm_xe_sync, 1> syncInputs;
     int waitUserFenceReturn = 0;
 };
@@ -1150,3 +1157,161 @@ TEST(IoctlHelperXeTest, WhenSetupIpVersionIsCalledThenIpVersionIsCorrect) {
     xeIoctlHelper->setupIpVersion();
     EXPECT_EQ(config, hwInfo.ipVersion.value);
 }
+
+TEST(IoctlHelperXeTest, givenVmBindBatchWhenCallingVmBindThenBindsAreSubmittedWithSingleIoctlAndFenceValueOnFlush) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    constexpr uint32_t numBinds = 64u;
+    VmBindParams vmBindParams[numBinds]{};
+    for (uint32_t i = 0; i < numBinds; i++) {
+        BindInfo mockBindInfo{};
+        mockBindInfo.handle = 0x1000 + i;
+        xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+        vmBindParams[i].vmId = 1u;
+        vmBindParams[i].handle = mockBindInfo.handle;
+        vmBindParams[i].start = MemoryConstants::pageSize64k * i;
+        vmBindParams[i].length = MemoryConstants::pageSize64k;
+    }
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_TRUE(xeIoctlHelper->isVmBindBatchOpen());
+    for (uint32_t i = 0; i < numBinds; i++) {
+        EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[i]));
+    }
+    EXPECT_EQ(0u, drm.vmBindInputs.size());
+    EXPECT_EQ(0u, drm.waitUserFenceInputs.size());
+
+    uint64_t fenceAddress = 0x4321;
+    uint64_t fenceValue = 0x789;
+    EXPECT_EQ(0, xeIoctlHelper->flushVmBindBatch(fenceAddress, fenceValue));
+    EXPECT_FALSE(xeIoctlHelper->isVmBindBatchOpen());
+    ASSERT_EQ(1u, drm.vmBindInputs.size());
+    EXPECT_EQ(numBinds, drm.vmBindInputs[0].num_binds);
+    EXPECT_EQ(1u, drm.vmBindInputs[0].vm_id);
+    ASSERT_EQ(numBinds, drm.vmBindOpInputs.size());
+    for (uint32_t i = 0; i < numBinds; i++) {
+        EXPECT_EQ(vmBindParams[i].handle, drm.vmBindOpInputs[i].obj);
+        EXPECT_EQ(vmBindParams[i].start, drm.vmBindOpInputs[i].addr);
+    }
+
+    ASSERT_EQ(1u, drm.syncInputs.size());
+    EXPECT_EQ(fenceAddress, drm.syncInputs[0].addr);
+    EXPECT_EQ(fenceValue, drm.syncInputs[0].timeline_value);
+    ASSERT_EQ(1u, drm.waitUserFenceInputs.size());
+    EXPECT_EQ(fenceValue, drm.waitUserFenceInputs[0].value);
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, fenceAddress, fenceValue + 1, 0u);
+    vmBindParams[0].extensions = castToUint64(&vmBindExtUserFence);
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[0]));
+    EXPECT_EQ(2u, drm.vmBindInputs.size());
+}
+
+TEST(IoctlHelperXeTest, givenVmBindBatchWhenBindingToDifferentVmThenUnrecoverableIsHit) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    BindInfo mockBindInfo{};
+    mockBindInfo.handle = 0x1234;
+    xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = mockBindInfo.handle;
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_FALSE(xeIoctlHelper->beginVmBindBatch());
+
+    vmBindParams.vmId = 1u;
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    vmBindParams.vmId = 2u;
+    EXPECT_THROW(xeIoctlHelper->vmBind(vmBindParams), std::exception);
+    EXPECT_EQ(0u, drm.vmBindInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->flushVmBindBatch(0x4321, 0x789));
+    ASSERT_EQ(1u, drm.vmBindInputs.size());
+    EXPECT_EQ(1u, drm.vmBindInputs[0].vm_id);
+    EXPECT_EQ(1u, drm.vmBindInputs[0].num_binds);
+}
+
+TEST(IoctlHelperXeTest, givenDefaultVmBindBatchingSettingWhenBeginningBatchThenBindsAreNotDeferred) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    BindInfo mockBindInfo{};
+    mockBindInfo.handle = 0x1234;
+    xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = mockBindInfo.handle;
+    vmBindParams.extensions = castToUint64(&vmBindExtUserFence);
+
+    EXPECT_FALSE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_FALSE(xeIoctlHelper->isVmBindBatchOpen());
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(2u, drm.vmBindInputs.size());
+    EXPECT_EQ(0, xeIoctlHelper->flushVmBindBatch(0x4321, 0x78a));
+    EXPECT_EQ(2u, drm.vmBindInputs.size());
+}
+
+TEST(IoctlHelperXeTest, givenVmBindBatchWhenUnbindingThenUnbindIsNotDeferred) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    BindInfo mockBindInfo{};
+    mockBindInfo.handle = 0x1234;
+    xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = mockBindInfo.handle;
+    vmBindParams.extensions = castToUint64(&vmBindExtUserFence);
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_EQ(0, xeIoctlHelper->vmUnbind(vmBindParams));
+    EXPECT_EQ(1u, drm.vmBindInputs.size());
+    EXPECT_EQ(0, xeIoctlHelper->flushVmBindBatch(0x4321, 0x78a));
+    EXPECT_EQ(1u, drm.vmBindInputs.size());
+}
+
+TEST(IoctlHelperXeTest, givenVmBindBatchWhenBatchedIoctlFailsThenErrorIsReturnedFromFlush) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    BindInfo mockBindInfo{};
+    mockBindInfo.handle = 0x1234;
+    xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = mockBindInfo.handle;
+
+    drm.gemVmBindReturn = -1;
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(-1, xeIoctlHelper->flushVmBindBatch(0x4321, 0x789));
+    EXPECT_EQ(1u, drm.vmBindInputs.size());
+    EXPECT_EQ(0u, drm.waitUserFenceInputs.size());
+    EXPECT_FALSE(xeIoctlHelper->isVmBindBatchOpen());
+}
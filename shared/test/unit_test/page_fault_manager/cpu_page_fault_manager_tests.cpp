@@ -345,6 +345,29 @@ TEST_F(PageFaultManagerTest, givenHandlerRegisteredAndUntrackedPageFaultAddressW
     EXPECT_FALSE(retVal);
 }
 
+TEST_F(PageFaultManagerTest, givenMultipleAllocsWhenVerifyingPageFaultAddressThenOnlyAddressInsideAllocIsResolved) {
+    void *alloc1 = reinterpret_cast<void *>(0x100);
+    void *alloc2 = reinterpret_cast<void *>(0x1000);
+    void *alloc3 = reinterpret_cast<void *>(0x2000);
+
+    pageFaultManager->insertAllocation(alloc3, 0x100, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc1, 0x100, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc2, 0x100, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0xFF)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(ptrOffset(alloc1, 0x100)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(ptrOffset(alloc3, 0x100)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 0);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc2, 0xFF)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc2);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc1));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 2);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc1);
+}
+
 TEST_F(PageFaultManagerTest, givenTrackedPageFaultAddressWhenVerifyingThenProperAllocIsTransferredToCpuDomain) {
     void *alloc1 = reinterpret_cast<void *>(0x1);
     void *alloc2 = reinterpret_cast<void *>(0x100);
@@ -766,3 +789,131 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
     EXPECT_EQ(allocs[3], unifiedMemoryManager->nonGpuDomainAllocs[3]);
 }
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeNotSetWhenInsertingAllocationThenAllocationIsNotChunked) {
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, 4 * MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(0u, pageFaultManager->memoryData[alloc].chunkSize);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].chunkDomains.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeSetWhenInsertingAllocationThenChunksAreTrackedOnlyForAllocationsLargerThanChunk) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.SharedAllocMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize + 1));
+    void *smallAlloc = reinterpret_cast<void *>(0x10000);
+    void *bigAlloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(smallAlloc, 2 * MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(bigAlloc, 5 * MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_EQ(0u, pageFaultManager->memoryData[smallAlloc].chunkSize);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, pageFaultManager->memoryData[bigAlloc].chunkSize);
+    ASSERT_EQ(3u, pageFaultManager->memoryData[bigAlloc].chunkDomains.size());
+    for (auto chunkDomain : pageFaultManager->memoryData[bigAlloc].chunkDomains) {
+        EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, chunkDomain);
+    }
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationInGpuDomainWhenVerifyingPageFaultThenOnlyFaultedChunkIsTransferredAndUnprotected) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.SharedAllocMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    const size_t allocSize = 4 * MemoryConstants::pageSize;
+
+    pageFaultManager->insertAllocation(alloc, allocSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(1, pageFaultManager->transferRangesToGpuCalled);
+    EXPECT_EQ(0u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    auto chunkPtr = ptrOffset(alloc, 2 * MemoryConstants::pageSize);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(chunkPtr, 0x10)));
+
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(chunkPtr, pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->transferToCpuSize);
+    EXPECT_EQ(chunkPtr, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->accessAllowedSize);
+
+    auto &pageFaultData = pageFaultManager->memoryData[alloc];
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultData.domain);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultData.chunkDomains[1]);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultData.chunkDomains[2]);
+    ASSERT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+    EXPECT_EQ(alloc, unifiedMemoryManager->nonGpuDomainAllocs[0]);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 3 * MemoryConstants::pageSize));
+    EXPECT_EQ(2, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationWithCpuChunksWhenMovingToGpuDomainThenAdjacentCpuChunksAreTransferredInOneRange) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.SharedAllocMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, 5 * MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, memoryProperties);
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 2 * MemoryConstants::pageSize));
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 3 * MemoryConstants::pageSize));
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+
+    pageFaultManager->protectMemoryCalled = 0;
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(1, pageFaultManager->transferRangesToGpuCalled);
+    ASSERT_EQ(2u, pageFaultManager->transferredRangesToGpu.size());
+    EXPECT_EQ(alloc, pageFaultManager->transferredRangesToGpu[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->transferredRangesToGpu[0].second);
+    EXPECT_EQ(ptrOffset(alloc, 2 * MemoryConstants::pageSize), pageFaultManager->transferredRangesToGpu[1].first);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, pageFaultManager->transferredRangesToGpu[1].second);
+    EXPECT_EQ(2, pageFaultManager->protectMemoryCalled);
+
+    for (auto chunkDomain : pageFaultManager->memoryData[alloc].chunkDomains) {
+        EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, chunkDomain);
+    }
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationInCpuDomainWhenRemovingAllocationThenWholeAllocationIsUnprotected) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.SharedAllocMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    const size_t allocSize = 4 * MemoryConstants::pageSize;
+
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, allocSize, unifiedMemoryManager.get(), nullptr, memoryProperties);
+    pageFaultManager->verifyPageFault(alloc);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(allocSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(0u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+    EXPECT_EQ(0u, pageFaultManager->memoryData.size());
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationInNoneDomainWhenMovingToGpuDomainThenChunksAreInGpuDomainAndCpuFaultTransfersChunk) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.SharedAllocMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, 4 * MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, memoryProperties);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::None, pageFaultManager->memoryData[alloc].domain);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(0, pageFaultManager->transferRangesToGpuCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultManager->memoryData[alloc].domain);
+    for (auto chunkDomain : pageFaultManager->memoryData[alloc].chunkDomains) {
+        EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, chunkDomain);
+    }
+
+    auto chunkPtr = ptrOffset(alloc, MemoryConstants::pageSize);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(chunkPtr));
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(chunkPtr, pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->transferToCpuSize);
+}
@@ -1022,6 +1022,19 @@ TEST_F(PrintFormatterTest, GivenTypeSmallerThan4BThenItIsReadAs4BValue) {
     EXPECT_STREQ(expectedOutput, output);
 }
 
+TEST_F(PrintFormatterTest, GivenMultipleRecordsWhenPrintingToStdoutThenAllRecordsArePrintedInOrder) {
+    auto stringIndex = injectFormatString("%d\\n");
+    for (int i = 0; i < 4; i++) {
+        storeData(stringIndex);
+        injectValue(i);
+    }
+
+    testing::internal::CaptureStdout();
+    printFormatter->printKernelOutput();
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_STREQ("0\n1\n2\n3\n", output.c_str());
+}
+
 TEST(printToStdoutTest, GivenStringWhenPrintingToStdoutThenOutputOccurs) {
     testing::internal::CaptureStdout();
     printToStdout("test");
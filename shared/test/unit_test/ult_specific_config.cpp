@@ -25,6 +25,11 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
 void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
 }
+void PageFaultManager::transferRangesToGpu(void *allocPtr, const std::vector<MemoryRange> &ranges, void *cmdQ) {
+}
+bool PageFaultManager::isChunkedMigrationSupported() const {
+    return true;
+}
 CompilerCacheConfig getDefaultCompilerCacheConfig() { return {}; }
 const char *getAdditionalBuiltinAsString(EBuiltInOps::Type builtin) { return nullptr; }
 
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/utilities/arena_heap_allocator.h"
+#include "shared/source/utilities/heap_allocator.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+constexpr uint64_t heapBase = 0x100000000ull;
+constexpr uint64_t heapSize = 64 * MemoryConstants::gigaByte;
+constexpr size_t arenaSize = 64 * MemoryConstants::megaByte;
+} // namespace
+
+class MockArenaHeapAllocator : public ArenaHeapAllocator {
+  public:
+    using ArenaHeapAllocator::ArenaHeapAllocator;
+    using ArenaHeapAllocator::arenas;
+    using ArenaHeapAllocator::findArena;
+};
+
+TEST(ArenaHeapAllocatorTest, givenSmallAllocationWhenAllocatingThenArenaIsReservedFromParentAndServesAllocation) {
+    HeapAllocator parent(heapBase, heapSize, MemoryConstants::pageSize64k);
+    MockArenaHeapAllocator arenaAllocator(parent, arenaSize, MemoryConstants::pageSize64k, 4u);
+
+    size_t size = MemoryConstants::pageSize64k;
+    auto ptr = arenaAllocator.allocateWithCustomAlignment(size, 0u);
+    EXPECT_NE(0ull, ptr);
+    EXPECT_EQ(1u, arenaAllocator.arenas.size());
+    EXPECT_EQ(arenaSize, parent.getUsedSize());
+
+    auto arena = arenaAllocator.findArena(ptr);
+    ASSERT_NE(nullptr, arena);
+    EXPECT_TRUE(isAligned(arena->base, ArenaHeapAllocator::arenaAlignment));
+
+    size_t secondSize = MemoryConstants::pageSize64k;
+    auto secondPtr = arenaAllocator.allocateWithCustomAlignment(secondSize, 0u);
+    EXPECT_NE(0ull, secondPtr);
+    EXPECT_EQ(arena, arenaAllocator.findArena(secondPtr));
+    EXPECT_EQ(arenaSize, parent.getUsedSize());
+
+    EXPECT_TRUE(arenaAllocator.free(ptr, size));
+    EXPECT_TRUE(arenaAllocator.free(secondPtr, secondSize));
+
+    ArenaHeapStatistics statistics;
+    arenaAllocator.getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.arenaCount);
+    EXPECT_EQ(arenaSize, statistics.reservedSize);
+    EXPECT_EQ(0u, statistics.usedSize);
+    EXPECT_EQ(2u, statistics.arenaAllocations);
+    EXPECT_EQ(0u, statistics.bypassedAllocations);
+    EXPECT_DOUBLE_EQ(1.0, statistics.getFragmentation());
+}
+
+TEST(ArenaHeapAllocatorTest, givenBigOrOverAlignedAllocationWhenAllocatingThenItIsLeftForParentAllocator) {
+    HeapAllocator parent(heapBase, heapSize, MemoryConstants::pageSize64k);
+    MockArenaHeapAllocator arenaAllocator(parent, arenaSize, MemoryConstants::pageSize64k, 4u);
+
+    size_t size = arenaSize / ArenaHeapAllocator::maxAllocationFraction + MemoryConstants::pageSize64k;
+    EXPECT_EQ(0ull, arenaAllocator.allocateWithCustomAlignment(size, 0u));
+
+    size = MemoryConstants::pageSize64k;
+    EXPECT_EQ(0ull, arenaAllocator.allocateWithCustomAlignment(size, 2 * ArenaHeapAllocator::arenaAlignment));
+
+    EXPECT_EQ(0u, arenaAllocator.arenas.size());
+    EXPECT_EQ(0u, parent.getUsedSize());
+
+    ArenaHeapStatistics statistics;
+    arenaAllocator.getStatistics(statistics);
+    EXPECT_EQ(2u, statistics.bypassedAllocations);
+    EXPECT_EQ(0u, statistics.arenaAllocations);
+}
+
+TEST(ArenaHeapAllocatorTest, givenAddressOutsideOfArenasWhenFreeingThenFalseIsReturned) {
+    HeapAllocator parent(heapBase, heapSize, MemoryConstants::pageSize64k);
+    MockArenaHeapAllocator arenaAllocator(parent, arenaSize, MemoryConstants::pageSize64k, 1u);
+
+    EXPECT_FALSE(arenaAllocator.free(heapBase, MemoryConstants::pageSize64k));
+
+    size_t size = MemoryConstants::pageSize64k;
+    auto ptr = arenaAllocator.allocateWithCustomAlignment(size, 0u);
+    auto arena = arenaAllocator.findArena(ptr);
+    ASSERT_NE(nullptr, arena);
+
+    EXPECT_FALSE(arenaAllocator.free(arena->base + arena->size, MemoryConstants::pageSize64k));
+    EXPECT_FALSE(arenaAllocator.free(arena->base - MemoryConstants::pageSize64k, MemoryConstants::pageSize64k));
+    EXPECT_TRUE(arenaAllocator.free(ptr, size));
+}
+
+TEST(ArenaHeapAllocatorTest, givenExhaustedArenaWhenAllocatingThenNewArenaIsReserved) {
+    HeapAllocator parent(heapBase, heapSize, MemoryConstants::pageSize64k);
+    MockArenaHeapAllocator arenaAllocator(parent, arenaSize, MemoryConstants::pageSize64k, 1u);
+
+    const size_t allocationSize = arenaSize / ArenaHeapAllocator::maxAllocationFraction;
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+    for (size_t i = 0; i < ArenaHeapAllocator::maxAllocationFraction + 1; i++) {
+        size_t size = allocationSize;
+        auto ptr = arenaAllocator.allocateWithCustomAlignment(size, 0u);
+        ASSERT_NE(0ull, ptr);
+        allocations.emplace_back(ptr, size);
+    }
+    EXPECT_EQ(2u, arenaAllocator.arenas.size());
+    EXPECT_EQ(2 * arenaSize, parent.getUsedSize());
+
+    for (auto &allocation : allocations) {
+        EXPECT_TRUE(arenaAllocator.free(allocation.first, allocation.second));
+    }
+    EXPECT_EQ(1u, arenaAllocator.arenas.size());
+    EXPECT_EQ(arenaSize, parent.getUsedSize());
+}
+
+TEST(ArenaHeapAllocatorTest, givenEmptiedArenaWhenStripeHasOtherArenasThenItIsReturnedToParent) {
+    HeapAllocator parent(heapBase, heapSize, MemoryConstants::pageSize64k);
+    MockArenaHeapAllocator arenaAllocator(parent, arenaSize, MemoryConstants::pageSize64k, 1u);
+
+    const size_t allocationSize = arenaSize / ArenaHeapAllocator::maxAllocationFraction;
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+    for (size_t i = 0; i < ArenaHeapAllocator::maxAllocationFraction + 1; i++) {
+        size_t size = allocationSize;
+        auto ptr = arenaAllocator.allocateWithCustomAlignment(size, 0u);
+        ASSERT_NE(0ull, ptr);
+        allocations.emplace_back(ptr, size);
+    }
+    ASSERT_EQ(2u, arenaAllocator.arenas.size());
+    auto firstArenaBase = arenaAllocator.findArena(allocations[0].first)->base;
+    auto lastAllocation = allocations.back();
+    allocations.pop_back();
+
+    for (size_t i = 0; i < allocations.size() - 1; i++) {
+        EXPECT_TRUE(arenaAllocator.free(allocations[i].first, allocations[i].second));
+    }
+    EXPECT_EQ(2u, arenaAllocator.arenas.size());
+    EXPECT_EQ(2 * arenaSize, parent.getUsedSize());
+
+    EXPECT_TRUE(arenaAllocator.free(allocations.back().first, allocations.back().second));
+    EXPECT_EQ(1u, arenaAllocator.arenas.size());
+    EXPECT_EQ(arenaSize, parent.getUsedSize());
+    EXPECT_EQ(nullptr, arenaAllocator.findArena(firstArenaBase));
+
+    EXPECT_TRUE(arenaAllocator.free(lastAllocation.first, lastAllocation.second));
+    EXPECT_EQ(1u, arenaAllocator.arenas.size());
+    EXPECT_EQ(arenaSize, parent.getUsedSize());
+
+    ArenaHeapStatistics statistics;
+    arenaAllocator.getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.arenaCount);
+    EXPECT_EQ(0u, statistics.usedSize);
+}
+
+TEST(ArenaHeapAllocatorTest, givenParentWithoutSpaceForArenaWhenAllocatingThenZeroIsReturned) {
+    HeapAllocator parent(heapBase, arenaSize / 2, MemoryConstants::pageSize64k);
+    MockArenaHeapAllocator arenaAllocator(parent, arenaSize, MemoryConstants::pageSize64k, 1u);
+
+    size_t size = MemoryConstants::pageSize64k;
+    EXPECT_EQ(0ull, arenaAllocator.allocateWithCustomAlignment(size, 0u));
+
+    ArenaHeapStatistics statistics;
+    arenaAllocator.getStatistics(statistics);
+    EXPECT_EQ(0u, statistics.arenaCount);
+    EXPECT_EQ(1u, statistics.bypassedAllocations);
+}
+
+TEST(ArenaHeapAllocatorTest, givenArenasWhenArenaAllocatorIsDestroyedThenArenasAreReturnedToParent) {
+    HeapAllocator parent(heapBase, heapSize, MemoryConstants::pageSize64k);
+    {
+        MockArenaHeapAllocator arenaAllocator(parent, arenaSize, MemoryConstants::pageSize64k, 1u);
+        size_t size = MemoryConstants::pageSize64k;
+        EXPECT_NE(0ull, arenaAllocator.allocateWithCustomAlignment(size, 0u));
+        EXPECT_EQ(arenaSize, parent.getUsedSize());
+    }
+    EXPECT_EQ(0u, parent.getUsedSize());
+}
+
+TEST(ArenaHeapAllocatorTest, givenMultipleThreadsWhenAllocatingAndFreeingThenAllocationsDoNotOverlapAndAreServedByArenas) {
+    constexpr uint32_t numThreads = 8u;
+    constexpr size_t allocationsPerThread = 2048u;
+
+    HeapAllocator parent(heapBase, heapSize, MemoryConstants::pageSize64k);
+    MockArenaHeapAllocator arenaAllocator(parent, arenaSize, MemoryConstants::pageSize64k, numThreads);
+
+    std::vector<std::vector<std::pair<uint64_t, size_t>>> perThreadAllocations(numThreads);
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0; threadId < numThreads; threadId++) {
+        threads.emplace_back([&, threadId]() {
+            auto &allocations = perThreadAllocations[threadId];
+            for (size_t i = 0; i < allocationsPerThread; i++) {
+                size_t size = MemoryConstants::pageSize64k * (1 + (i % 4));
+                auto ptr = arenaAllocator.allocateWithCustomAlignment(size, 0u);
+                allocations.emplace_back(ptr, size);
+                if (i % 2) {
+                    arenaAllocator.free(allocations.back().first, allocations.back().second);
+                    allocations.pop_back();
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    std::vector<std::pair<uint64_t, size_t>> allAllocations;
+    uint64_t usedSize = 0;
+    for (auto &allocations : perThreadAllocations) {
+        allAllocations.insert(allAllocations.end(), allocations.begin(), allocations.end());
+    }
+    std::sort(allAllocations.begin(), allAllocations.end());
+    for (size_t i = 0; i < allAllocations.size(); i++) {
+        EXPECT_NE(0ull, allAllocations[i].first);
+        EXPECT_NE(nullptr, arenaAllocator.findArena(allAllocations[i].first));
+        if (i > 0) {
+            EXPECT_LE(allAllocations[i - 1].first + allAllocations[i - 1].second, allAllocations[i].first);
+        }
+        usedSize += allAllocations[i].second;
+    }
+    EXPECT_EQ(numThreads * allocationsPerThread / 2, allAllocations.size());
+
+    ArenaHeapStatistics statistics;
+    arenaAllocator.getStatistics(statistics);
+    EXPECT_EQ(numThreads * allocationsPerThread, statistics.arenaAllocations);
+    EXPECT_EQ(0u, statistics.bypassedAllocations);
+    EXPECT_EQ(usedSize, statistics.usedSize);
+    EXPECT_EQ(statistics.arenaCount * arenaSize, parent.getUsedSize());
+
+    for (auto &allocation : allAllocations) {
+        EXPECT_TRUE(arenaAllocator.free(allocation.first, allocation.second));
+    }
+    arenaAllocator.getStatistics(statistics);
+    EXPECT_EQ(0u, statistics.usedSize);
+    EXPECT_GE(numThreads, statistics.arenaCount);
+    EXPECT_EQ(statistics.arenaCount * arenaSize, parent.getUsedSize());
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/chrome_trace_logger.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+using namespace NEO;
+
+struct ChromeTraceLoggerTest : ::testing::Test {
+    void SetUp() override {
+        auto stream = std::make_unique<std::stringstream>();
+        output = stream.get();
+        logger = std::make_unique<ChromeTraceLogger>(std::move(stream));
+    }
+
+    std::stringstream *output = nullptr;
+    std::unique_ptr<ChromeTraceLogger> logger;
+};
+
+TEST(ChromeTraceLogger, givenDefaultFileNameWhenCreatingLoggerThenLoggerIsDisabled) {
+    ChromeTraceLogger logger(std::string("unk"));
+    EXPECT_FALSE(logger.enabled());
+    logger.logSpan("span", ChromeTraceLogger::Track::Host, 0u, 0u, 1u);
+    logger.logInstant("instant", ChromeTraceLogger::Track::Host, 0u, 0u);
+}
+
+TEST(ChromeTraceLogger, whenWritingTimestampThenNanosecondsAreConvertedToMicroseconds) {
+    std::stringstream str;
+    ChromeTraceLogger::writeTimestamp(str, 1234567u);
+    EXPECT_STREQ("1234.567", str.str().c_str());
+
+    str.str(std::string());
+    ChromeTraceLogger::writeTimestamp(str, 5u);
+    EXPECT_STREQ("0.005", str.str().c_str());
+}
+
+TEST(ChromeTraceLogger, whenWritingEscapedTextThenQuotesAndBackslashesAreEscapedAndControlCharactersDropped) {
+    std::stringstream str;
+    ChromeTraceLogger::writeEscaped(str, "a\"b\\c\nd");
+    EXPECT_STREQ("a\\\"b\\\\cd", str.str().c_str());
+}
+
+TEST_F(ChromeTraceLoggerTest, givenEnabledLoggerWhenLoggingSpanThenCompleteEventIsWritten) {
+    EXPECT_TRUE(logger->enabled());
+    logger->logSpan("kernel", ChromeTraceLogger::Track::Gpu, 7u, 2000u, 5500u);
+
+    EXPECT_STREQ("[\n{\"name\":\"kernel\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":7,\"ts\":2.000,\"dur\":3.500}", output->str().c_str());
+}
+
+TEST_F(ChromeTraceLoggerTest, givenSpanEndingBeforeStartWhenLoggingSpanThenZeroDurationIsWritten) {
+    logger->logSpan("span", ChromeTraceLogger::Track::Host, 1u, 3000u, 2000u);
+
+    EXPECT_NE(std::string::npos, output->str().find("\"dur\":0.000}"));
+}
+
+TEST_F(ChromeTraceLoggerTest, givenEnabledLoggerWhenLoggingMultipleEventsThenEventsAreSeparatedByComma) {
+    logger->logInstant("flush", ChromeTraceLogger::Track::Host, 3u, 1000u);
+    logger->logSpan("copy", ChromeTraceLogger::Track::Host, 3u, 1000u, 2000u);
+
+    std::string expectedEvents = "[\n{\"name\":\"flush\",\"cat\":\"host\",\"ph\":\"i\",\"pid\":0,\"tid\":3,\"ts\":1.000,\"s\":\"t\"},\n"
+                                 "{\"name\":\"copy\",\"cat\":\"host\",\"ph\":\"X\",\"pid\":0,\"tid\":3,\"ts\":1.000,\"dur\":1.000}";
+    EXPECT_EQ(expectedEvents, output->str());
+}
+
+TEST(ChromeTraceLogger, givenEnabledLoggerWhenDestroyingThenEventArrayIsClosed) {
+    std::stringbuf buffer;
+    {
+        ChromeTraceLogger logger(std::make_unique<std::ostream>(&buffer));
+        logger.logInstant("a", ChromeTraceLogger::Track::Host, 0u, 0u);
+        EXPECT_EQ(std::string::npos, buffer.str().find("]"));
+    }
+    auto trace = buffer.str();
+    EXPECT_EQ('[', trace.front());
+    EXPECT_EQ("}\n]\n", trace.substr(trace.size() - 4));
+}